@@ -817,7 +817,9 @@ class CYIBitmovinVideoPlayer {
         const _properties = {
             streamFormats: [],
             externalTextTrackQueue: [],
-            externalTextTrackIdCounter: 1
+            externalTextTrackIdCounter: 1,
+            preloadedSources: [],
+            videoTimeIntervalMs: CYIBitmovinVideoPlayer.DefaultVideoTimeIntervalMs
         };
 
         const bitmovinPlayerVersion = CYIBitmovinVideoPlayer.getVersionData();
@@ -924,6 +926,62 @@ class CYIBitmovinVideoPlayer {
             }
         });
 
+        Object.defineProperty(self, "packedTelemetry", {
+            enumerable: true,
+            get() {
+                return _properties.packedTelemetry;
+            },
+            set(value) {
+                _properties.packedTelemetry = CYIUtilities.parseBoolean(value, true);
+            }
+        });
+
+        Object.defineProperty(self, "videoTimeIntervalMs", {
+            enumerable: true,
+            get() {
+                return _properties.videoTimeIntervalMs;
+            },
+            set(value) {
+                const newValue = CYIUtilities.parseInteger(value);
+
+                if(!isNaN(newValue) && newValue >= 0) {
+                    _properties.videoTimeIntervalMs = newValue;
+                }
+            }
+        });
+
+        Object.defineProperty(self, "instanceId", {
+            enumerable: true,
+            get() {
+                return _properties.instanceId;
+            },
+            set(value) {
+                const newValue = CYIUtilities.parseInteger(value);
+
+                _properties.instanceId = !isNaN(newValue) && newValue > 0 ? newValue : null;
+            }
+        });
+
+        Object.defineProperty(self, "prewarmed", {
+            enumerable: true,
+            get() {
+                return _properties.prewarmed;
+            },
+            set(value) {
+                _properties.prewarmed = CYIUtilities.parseBoolean(value, false);
+            }
+        });
+
+        Object.defineProperty(self, "attachedToPrewarmedPlayer", {
+            enumerable: true,
+            get() {
+                return _properties.attachedToPrewarmedPlayer;
+            },
+            set(value) {
+                _properties.attachedToPrewarmedPlayer = CYIUtilities.parseBoolean(value, false);
+            }
+        });
+
         Object.defineProperty(self, "verboseStateChanges", {
             enumerable: true,
             get() {
@@ -1055,6 +1113,13 @@ class CYIBitmovinVideoPlayer {
             }
         });
 
+        Object.defineProperty(self, "preloadedSources", {
+            enumerable: true,
+            get() {
+                return _properties.preloadedSources;
+            }
+        });
+
         Object.defineProperty(self, "player", {
             enumerable: true,
             get() {
@@ -1189,6 +1254,36 @@ class CYIBitmovinVideoPlayer {
             }
         });
 
+        Object.defineProperty(self, "stateSnapshotVersion", {
+            enumerable: true,
+            get() {
+                return _properties.stateSnapshotVersion;
+            },
+            set(value) {
+                const newValue = CYIUtilities.parseInteger(value, 0);
+
+                if(newValue >= 0) {
+                    _properties.stateSnapshotVersion = newValue;
+                }
+            }
+        });
+
+        Object.defineProperty(self, "videoRectangleAnimationId", {
+            enumerable: true,
+            get() {
+                return _properties.videoRectangleAnimationId;
+            },
+            set(value) {
+                let newValue = CYIUtilities.parseInteger(value, null);
+
+                if(newValue !== null && newValue < 0) {
+                    newValue = null;
+                }
+
+                _properties.videoRectangleAnimationId = newValue;
+            }
+        });
+
         Object.defineProperty(self, "stallDetectorId", {
             enumerable: true,
             get() {
@@ -1280,6 +1375,12 @@ class CYIBitmovinVideoPlayer {
         self.video = null;
         self.verbose = CYIUtilities.isObjectStrict(configuration) ? CYIUtilities.parseBoolean(configuration.verbose, false) : false;
         self.verboseStateChanges = false;
+        self.instanceId = null;
+        self.prewarmed = false;
+        self.attachedToPrewarmedPlayer = false;
+        self.packedTelemetry = CYIUtilities.isObjectStrict(configuration) ? CYIUtilities.parseBoolean(configuration.packedTelemetry, true) : true;
+        self.videoTimeIntervalMs = CYIUtilities.isObjectStrict(configuration) ? configuration.videoTimeIntervalMs : null; // note: invalid values keep the default interval
+        self.lastVideoTimeNotificationMs = 0;
         self.streamFormat = null;
         self.currentDurationSeconds = null;
         self.initialAudioBitrateKbps = null;
@@ -1300,6 +1401,8 @@ class CYIBitmovinVideoPlayer {
         self.wasMakingProgress = false;
         self.handlingStall = false;
         self.stallDetectorId = null;
+        self.videoRectangleAnimationId = null;
+        self.stateSnapshotVersion = 0;
         self.requestedTextTrackId = null;
 
         self.registerStreamFormat("DASH", ["PlayReady", "Widevine"]);
@@ -1329,15 +1432,181 @@ class CYIBitmovinVideoPlayer {
     }
 
     static createInstance(configuration) {
-        if(CYIUtilities.isValid(CYIBitmovinVideoPlayer.instance)) {
-            throw CYIUtilities.createError("Cannot create more than one " + CYIBitmovinVideoPlayer.getType() + " video player instance!");
+        const instanceId = CYIUtilities.isObjectStrict(configuration) ? CYIUtilities.parseInteger(configuration.instanceId) : NaN;
+
+        // native players which predate instance IDs always use the first one
+        const formattedInstanceId = !isNaN(instanceId) && instanceId > 0 ? instanceId : 1;
+
+        if(CYIUtilities.isValid(CYIBitmovinVideoPlayer.getInstance(formattedInstanceId))) {
+            throw CYIUtilities.createError(CYIBitmovinVideoPlayer.getType() + " video player instance " + formattedInstanceId + " already exists!");
+        }
+
+        let instance = CYIBitmovinVideoPlayer.prewarmedInstance;
+        CYIBitmovinVideoPlayer.prewarmedInstance = null;
+
+        if(CYIUtilities.isInvalid(instance) || !instance.attach(configuration)) {
+            instance = new CYIBitmovinVideoPlayer(configuration);
         }
 
-        CYIBitmovinVideoPlayer.instance = new CYIBitmovinVideoPlayer(configuration);
+        CYIBitmovinVideoPlayer.registerInstance(instance, formattedInstanceId);
     };
 
-    static getInstance() {
-        return CYIBitmovinVideoPlayer.instance;
+    static prewarm(configuration) {
+        // an instance which already exists belongs to a native player and is warm by definition
+        if(CYIUtilities.isValid(CYIBitmovinVideoPlayer.getInstance())) {
+            return true;
+        }
+
+        let instance = CYIBitmovinVideoPlayer.prewarmedInstance;
+
+        if(CYIUtilities.isInvalid(instance)) {
+            instance = new CYIBitmovinVideoPlayer(configuration);
+            instance.prewarmed = true;
+
+            CYIBitmovinVideoPlayer.prewarmedInstance = instance;
+        }
+
+        if(!instance.initialized) {
+            instance.initialize();
+        }
+
+        if(instance.verbose) {
+            console.log(CYIBitmovinVideoPlayer.getType() + " player pre-warmed.");
+        }
+
+        return instance.initialized;
+    }
+
+    static registerInstance(instance, instanceId) {
+        if(!CYIUtilities.isObjectStrict(CYIBitmovinVideoPlayer.instances)) {
+            CYIBitmovinVideoPlayer.instances = { };
+        }
+
+        instance.instanceId = instanceId;
+        CYIBitmovinVideoPlayer.instances[instanceId] = instance;
+
+        // each native player calls its instance through an accessor of its own, since instance accessors cannot be passed arguments
+        Object.defineProperty(CYIBitmovinVideoPlayer, CYIBitmovinVideoPlayer.getInstanceAccessorName(instanceId), {
+            configurable: true,
+            value: function getInstanceById() {
+                return CYIBitmovinVideoPlayer.getInstance(instanceId);
+            }
+        });
+    }
+
+    static unregisterInstance(instance) {
+        const instanceId = instance.instanceId;
+
+        if(CYIUtilities.isInvalid(instanceId) || !CYIUtilities.isObjectStrict(CYIBitmovinVideoPlayer.instances) || CYIBitmovinVideoPlayer.instances[instanceId] !== instance) {
+            return;
+        }
+
+        delete CYIBitmovinVideoPlayer.instances[instanceId];
+        delete CYIBitmovinVideoPlayer[CYIBitmovinVideoPlayer.getInstanceAccessorName(instanceId)];
+    }
+
+    static getInstanceAccessorName(instanceId) {
+        return "getInstance" + instanceId;
+    }
+
+    static getInstance(instanceId) {
+        const instances = CYIBitmovinVideoPlayer.instances;
+
+        if(!CYIUtilities.isObjectStrict(instances)) {
+            return null;
+        }
+
+        if(CYIUtilities.isValid(instanceId)) {
+            return CYIUtilities.isValid(instances[instanceId]) ? instances[instanceId] : null;
+        }
+
+        // without an instance ID the oldest instance is returned, which is the only one unless several native players exist
+        const instanceIds = Object.keys(instances);
+
+        return instanceIds.length !== 0 ? instances[instanceIds[0]] : null;
+    }
+
+    static executeCommandBatch(commands) {
+        if(!Array.isArray(commands)) {
+            throw CYIUtilities.createError("Invalid " + CYIBitmovinVideoPlayer.getType() + " command batch, expected array.");
+        }
+
+        const results = [];
+
+        for(let i = 0; i < commands.length; i++) {
+            const command = commands[i];
+
+            try {
+                if(!CYIUtilities.isObjectStrict(command) || CYIUtilities.isEmptyString(command.functionName)) {
+                    throw CYIUtilities.createError("Invalid " + CYIBitmovinVideoPlayer.getType() + " command at index " + i + " in command batch.");
+                }
+
+                const target = command.instance ? CYIBitmovinVideoPlayer.getInstance(command.instanceId) : CYIBitmovinVideoPlayer;
+
+                if(CYIUtilities.isInvalid(target)) {
+                    throw CYIUtilities.createError("Cannot execute " + command.functionName + " function, " + CYIBitmovinVideoPlayer.getType() + " video player instance does not exist.");
+                }
+
+                if(typeof target[command.functionName] !== "function") {
+                    throw CYIUtilities.createError(CYIBitmovinVideoPlayer.getType() + " video player does not have a " + command.functionName + " function.");
+                }
+
+                const result = target[command.functionName].apply(target, Array.isArray(command.arguments) ? command.arguments : []);
+
+                results.push({
+                    result: CYIUtilities.isValid(result) ? result : null
+                });
+            }
+            catch(error) {
+                results.push({
+                    error: {
+                        message: error.message,
+                        stack: error.stack
+                    }
+                });
+            }
+        }
+
+        return results;
+    }
+
+    static warmKeySystem(drmType) {
+        if(CYIUtilities.isEmptyString(drmType) || typeof navigator.requestMediaKeySystemAccess !== "function") {
+            return null;
+        }
+
+        const formattedDRMType = drmType.trim().toLowerCase();
+        let keySystem = null;
+
+        if(formattedDRMType === "playready") {
+            keySystem = "com.microsoft.playready";
+        }
+        else if(formattedDRMType.indexOf("widevine") === 0) {
+            keySystem = "com.widevine.alpha";
+        }
+        else {
+            return null;
+        }
+
+        if(!CYIUtilities.isObjectStrict(CYIBitmovinVideoPlayer.warmKeySystems)) {
+            CYIBitmovinVideoPlayer.warmKeySystems = { };
+        }
+
+        // creating media keys loads and initializes the content decryption module, which would otherwise happen when the first licence is requested
+        if(CYIUtilities.isInvalid(CYIBitmovinVideoPlayer.warmKeySystems[keySystem])) {
+            CYIBitmovinVideoPlayer.warmKeySystems[keySystem] = navigator.requestMediaKeySystemAccess(keySystem, [{
+                initDataTypes: ["cenc"],
+                videoCapabilities: [{ contentType: "video/mp4; codecs=\"avc1.42E01E\"" }]
+            }]).then(function(keySystemAccess) {
+                return keySystemAccess.createMediaKeys();
+            }).catch(function(error) {
+                delete CYIBitmovinVideoPlayer.warmKeySystems[keySystem];
+
+                console.warn(CYIBitmovinVideoPlayer.getType() + " player failed to initialize " + keySystem + " key system: " + error.message);
+            });
+        }
+
+        return CYIBitmovinVideoPlayer.warmKeySystems[keySystem];
     }
 
     static generateAudioTrackTitle(audioTrack, addToTrack) {
@@ -1404,6 +1673,36 @@ class CYIBitmovinVideoPlayer {
         return CYIBitmovinVideoPlayer.playerVersion;
     }
 
+    attach(configuration) {
+        const self = this;
+
+        if(!CYIUtilities.isObject(configuration)) {
+            throw CYIUtilities.createError("Missing or invalid " + CYIBitmovinVideoPlayer.getType() + " player configuration!");
+        }
+
+        self.prewarmed = false;
+
+        // the Bitmovin player is constructed with the API key and application ID, so a player pre-warmed with different ones cannot be reused
+        if(self.apiKey !== CYIUtilities.trimString(configuration.apiKey) || self.appId !== CYIUtilities.trimString(configuration.appId)) {
+            console.warn(CYIBitmovinVideoPlayer.getType() + " player configuration does not match the pre-warmed player, discarding it.");
+
+            self.destroy();
+
+            return false;
+        }
+
+        self.verbose = CYIUtilities.isObjectStrict(configuration) ? CYIUtilities.parseBoolean(configuration.verbose, false) : false;
+        self.packedTelemetry = CYIUtilities.isObjectStrict(configuration) ? CYIUtilities.parseBoolean(configuration.packedTelemetry, true) : true;
+        self.videoTimeIntervalMs = CYIUtilities.isObjectStrict(configuration) ? configuration.videoTimeIntervalMs : null;
+        self.attachedToPrewarmedPlayer = true;
+
+        if(self.verbose) {
+            console.log(CYIBitmovinVideoPlayer.getType() + " player attached to pre-warmed player.");
+        }
+
+        return true;
+    }
+
     initialize(name) {
         const self = this;
 
@@ -1411,6 +1710,22 @@ class CYIBitmovinVideoPlayer {
             throw CYIUtilities.createError("Bitmovin is not currently supported on UWP.");
         }
 
+        // a pre-warmed player is already initialized, its state is re-sent for the native player which has just attached to it
+        if(self.attachedToPrewarmedPlayer) {
+            self.attachedToPrewarmedPlayer = false;
+
+            if(self.initialized) {
+                if(CYIUtilities.isValid(name)) {
+                    self.setNickname(name);
+                }
+
+                self.sendEvent("stateChanged", self.state.id);
+                self.notifyStateSnapshot();
+
+                return true;
+            }
+        }
+
         if(self.state !== CYIBitmovinVideoPlayer.State.Uninitialized) {
             throw CYIUtilities.createError(CYIBitmovinVideoPlayer.getType() + " player is already initialized!");
         }
@@ -1621,6 +1936,14 @@ class CYIBitmovinVideoPlayer {
             self.notifyActiveAudioTrackChanged();
         });
 
+        self.player.on(bitmovin.player.PlayerEvent.Muted, function onMutedEvent(event) {
+            self.notifyMuteStatusChanged();
+        });
+
+        self.player.on(bitmovin.player.PlayerEvent.Unmuted, function onUnmutedEvent(event) {
+            self.notifyMuteStatusChanged();
+        });
+
         self.player.on(bitmovin.player.PlayerEvent.Play, function onPlayEvent(event) {
             if(self.state === CYIBitmovinVideoPlayer.State.Playing) {
                 return;
@@ -1634,6 +1957,9 @@ class CYIBitmovinVideoPlayer {
                 return;
             }
 
+            // periodic time updates may be throttled or disabled, so the position the player paused at is always reported
+            self.notifyVideoTimeChanged();
+
             self.updateState(CYIBitmovinVideoPlayer.State.Paused);
         });
 
@@ -1646,7 +1972,15 @@ class CYIBitmovinVideoPlayer {
                 return;
             }
 
-            self.notifyVideoTimeChanged();
+            self.notifyVideoTimeChanged(true);
+        });
+
+        self.player.on(bitmovin.player.PlayerEvent.Seeked, function onSeekedEvent(event) {
+            if(!self.player) {
+                return;
+            }
+
+            self.notifySeekCompleted();
         });
 
         self.player.on(bitmovin.player.PlayerEvent.DurationChanged, function onDurationChangedEvent(event) {
@@ -1945,12 +2279,33 @@ class CYIBitmovinVideoPlayer {
 
         self.sendEvent("stateChanged", self.state.id);
 
+        self.notifyStateSnapshot();
+
         if(self.verbose && self.verboseStateChanges) {
             console.log(self.getDisplayName() + " transitioned from " + previousState.displayName + " to " + state.displayName + ".");
         }
     }
 
-    setVideoRectangle(x, y, width, height) {
+    setVideoTimeInterval(intervalMs) {
+        const self = this;
+
+        const formattedIntervalMs = CYIUtilities.parseInteger(intervalMs);
+
+        if(isNaN(formattedIntervalMs) || formattedIntervalMs < 0) {
+            throw CYIUtilities.createError(self.getDisplayName() + " received an invalid video time interval: " + intervalMs);
+        }
+
+        self.videoTimeIntervalMs = formattedIntervalMs;
+
+        // the next time changed event is reported immediately, so a faster cadence takes effect without waiting out the previous interval
+        self.lastVideoTimeNotificationMs = 0;
+
+        if(self.verbose) {
+            console.log(self.getDisplayName() + " video time interval set to " + formattedIntervalMs + "ms.");
+        }
+    }
+
+    setVideoRectangle(x, y, width, height, transitionDurationMs) {
         const self = this;
 
         if(CYIUtilities.isObject(x)) {
@@ -1959,6 +2314,7 @@ class CYIBitmovinVideoPlayer {
             y = data.y;
             width = data.width;
             height = data.height;
+            transitionDurationMs = data.transitionDurationMs;
         }
 
         if(CYIUtilities.isInvalid(self.container) || CYIUtilities.isInvalid(self.video)) {
@@ -1970,6 +2326,7 @@ class CYIBitmovinVideoPlayer {
         const formattedYPosition = CYIUtilities.parseInteger(y);
         const formattedWidth = CYIUtilities.parseInteger(width);
         const formattedHeight = CYIUtilities.parseInteger(height);
+        const formattedTransitionDurationMs = CYIUtilities.parseInteger(transitionDurationMs, 0);
 
         if(!Number.isInteger(formattedXPosition)) {
             throw CYIUtilities.createError(self.getDisplayName() + " received an invalid x position for the video rectangle: " + x);
@@ -1987,18 +2344,58 @@ class CYIBitmovinVideoPlayer {
             throw CYIUtilities.createError(self.getDisplayName() + " received an invalid height for the video rectangle: " + height);
         }
 
+        if(self.videoRectangleAnimationId !== null) {
+            window.cancelAnimationFrame(self.videoRectangleAnimationId);
+            self.videoRectangleAnimationId = null;
+        }
+
+        self.requestedVideoRectangle = null;
+
+        const position = formattedTransitionDurationMs > 0 ? self.getPosition() : null;
+        const size = formattedTransitionDurationMs > 0 ? self.getSize() : null;
+
+        if(CYIUtilities.isInvalid(position) || CYIUtilities.isInvalid(size)) {
+            self.applyVideoRectangle(formattedXPosition, formattedYPosition, formattedWidth, formattedHeight);
+            return;
+        }
+
+        // interpolate from the currently displayed rectangle to the new keyframe over the transition duration
+        const startRectangle = new CYIRectangle(position.x, position.y, size.width, size.height);
+        const startTimeMs = window.performance.now();
+
+        const animateVideoRectangle = function animateVideoRectangle(currentTimeMs) {
+            const progress = Math.min(Math.max((currentTimeMs - startTimeMs) / formattedTransitionDurationMs, 0), 1);
+
+            self.applyVideoRectangle(
+                Math.round(startRectangle.x + (formattedXPosition - startRectangle.x) * progress),
+                Math.round(startRectangle.y + (formattedYPosition - startRectangle.y) * progress),
+                Math.round(startRectangle.width + (formattedWidth - startRectangle.width) * progress),
+                Math.round(startRectangle.height + (formattedHeight - startRectangle.height) * progress)
+            );
+
+            self.videoRectangleAnimationId = progress < 1 ? window.requestAnimationFrame(animateVideoRectangle) : null;
+        };
+
+        self.videoRectangleAnimationId = window.requestAnimationFrame(animateVideoRectangle);
+    }
+
+    applyVideoRectangle(x, y, width, height) {
+        const self = this;
+
+        if(CYIUtilities.isInvalid(self.container) || CYIUtilities.isInvalid(self.video)) {
+            return;
+        }
+
         self.container.style.position = "absolute";
-        self.container.style.left = formattedXPosition + "px";
-        self.container.style.top = formattedYPosition + "px";
-        self.container.style.width = formattedWidth + "px";
-        self.container.style.height = formattedHeight + "px";
+        self.container.style.left = x + "px";
+        self.container.style.top = y + "px";
+        self.container.style.width = width + "px";
+        self.container.style.height = height + "px";
 
         if(self.container !== self.video) {
             self.video.style.width = self.container.style.width;
             self.video.style.height = self.container.style.height;
         }
-
-        self.requestedVideoRectangle = null;
     }
 
     shouldBeMakingProgress() {
@@ -2131,6 +2528,102 @@ class CYIBitmovinVideoPlayer {
         self.drmConfiguration = drmConfiguration;
     }
 
+    preloadSource(url, format, drmConfiguration) {
+        const self = this;
+
+        if(CYIUtilities.isObjectStrict(url)) {
+            const data = url;
+            url = data.url;
+            format = data.format;
+            drmConfiguration = data.drmConfiguration;
+        }
+
+        if(CYIUtilities.isEmptyString(url)) {
+            throw CYIUtilities.createError(self.getDisplayName() + " requires a non-empty url string to preload a source.");
+        }
+
+        const drmType = CYIUtilities.isObjectStrict(drmConfiguration) ? drmConfiguration.type : null;
+
+        if(!self.isStreamFormatSupported(format, drmType)) {
+            throw CYIUtilities.createError(CYIBitmovinVideoPlayer.name + " does not support " + format + " stream formats" + (CYIUtilities.isNonEmptyString(drmType) ? " with " + drmType + " DRM." : "."));
+        }
+
+        // a player torn down by stop is constructed again right away so that the next prepare does not pay for it, playback in progress is left alone
+        if(!self.initialized && CYIUtilities.isNonEmptyString(self.apiKey)) {
+            self.initialize();
+        }
+
+        if(CYIUtilities.isNonEmptyString(drmType)) {
+            CYIBitmovinVideoPlayer.warmKeySystem(drmType);
+        }
+
+        for(let i = 0; i < self.preloadedSources.length; i++) {
+            if(self.preloadedSources[i].url === url) {
+                return true;
+            }
+        }
+
+        const preloadedSource = {
+            url: url,
+            format: format,
+            drmType: drmType,
+            startTimeMs: Date.now(),
+            loaded: false
+        };
+
+        self.preloadedSources.push(preloadedSource);
+
+        while(self.preloadedSources.length > CYIBitmovinVideoPlayer.MaximumPreloadedSourceCount) {
+            self.preloadedSources.shift();
+        }
+
+        const requestOptions = { };
+
+        // progressive sources are only fetched up to the start of the media data, adaptive sources only have their manifest fetched
+        if(CYIUtilities.isNonEmptyString(format) && format.toUpperCase() === "MP4") {
+            requestOptions.headers = {
+                Range: "bytes=0-" + (CYIBitmovinVideoPlayer.PreloadedProgressiveByteCount - 1)
+            };
+        }
+
+        // fetching the source resolves its host, opens the connection and leaves the response in the HTTP cache for the player to pick up
+        fetch(url, requestOptions).then(function(response) {
+            if(!response.ok) {
+                throw CYIUtilities.createError("HTTP status " + response.status);
+            }
+
+            return response.arrayBuffer();
+        }).then(function(data) {
+            preloadedSource.loaded = true;
+
+            if(self.verbose) {
+                console.log(self.getDisplayName() + " preloaded " + data.byteLength + " bytes of " + url + " in " + (Date.now() - preloadedSource.startTimeMs) + "ms.");
+            }
+        }).catch(function(error) {
+            const preloadedSourceIndex = self.preloadedSources.indexOf(preloadedSource);
+
+            if(preloadedSourceIndex !== -1) {
+                self.preloadedSources.splice(preloadedSourceIndex, 1);
+            }
+
+            console.warn(self.getDisplayName() + " failed to preload " + url + ": " + error.message);
+        });
+
+        return true;
+    }
+
+    takePreloadedSource(url) {
+        const self = this;
+
+        for(let i = 0; i < self.preloadedSources.length; i++) {
+            if(self.preloadedSources[i].url === url) {
+                return self.preloadedSources.splice(i, 1)[0];
+            }
+        }
+
+        return null;
+    }
+
     prepare(url, format, startTimeSeconds, maxBitrateKbps, drmConfiguration) {
         const self = this;
 
@@ -2173,6 +2666,9 @@ class CYIBitmovinVideoPlayer {
 
         self.updateState(CYIBitmovinVideoPlayer.State.Loading);
 
+        // the first time changed event of the new video is reported immediately rather than waiting out the interval left by the previous one
+        self.lastVideoTimeNotificationMs = 0;
+
         if(CYIUtilities.isValid(self.streamFormat)) {
             self.streamFormat.format = format;
         }
@@ -2264,6 +2760,12 @@ class CYIBitmovinVideoPlayer {
 
         self.drmConfiguration = null;
 
+        const preloadedSource = self.takePreloadedSource(url);
+
+        if(CYIUtilities.isValid(preloadedSource) && self.verbose) {
+            console.log(self.getDisplayName() + " loading source " + (preloadedSource.loaded ? "preloaded " : "still being preloaded ") + (Date.now() - preloadedSource.startTimeMs) + "ms ago.");
+        }
+
         self.player.load(
             sourceConfiguration
         ).then(function(player) {
@@ -2457,12 +2959,19 @@ class CYIBitmovinVideoPlayer {
     destroy() {
         const self = this;
 
+        CYIBitmovinVideoPlayer.unregisterInstance(self);
+
         if(!self.player) {
             return;
         }
 
         self.stop();
 
+        if(self.videoRectangleAnimationId !== null) {
+            window.cancelAnimationFrame(self.videoRectangleAnimationId);
+            self.videoRectangleAnimationId = null;
+        }
+
         self.state = CYIBitmovinVideoPlayer.State.Uninitialized;
         self.apiKey = null;
         self.player = null;
@@ -2498,16 +3007,18 @@ class CYIBitmovinVideoPlayer {
         self.checkInitialized();
 
         if(CYIUtilities.isInvalidNumber(timeSeconds)) {
-            return;
+            return false;
         }
 
-        self.player.seek(CYIUtilities.clamp(timeSeconds, 0, self.player.getDuration()));
+        const seeking = self.player.seek(CYIUtilities.clamp(timeSeconds, 0, self.player.getDuration()));
 
         if(self.verbose) {
             console.log(self.getDisplayName() + " seeked to " + timeSeconds + "s.");
         }
 
         self.notifyVideoTimeChanged();
+
+        return seeking !== false;
     }
 
     isMuted() {
@@ -3308,6 +3819,28 @@ class CYIBitmovinVideoPlayer {
         return true;
     }
 
+    getStreamFormatSupport(queries) {
+        const self = this;
+
+        if(!Array.isArray(queries)) {
+            throw CYIUtilities.createError(self.getDisplayName() + " received invalid stream format support queries, expected array.");
+        }
+
+        // note: each query is a stream format and optional drm type pair, the results are returned in the same order
+        const supported = [];
+
+        for(let i = 0; i < queries.length; i++) {
+            const query = queries[i];
+
+            supported.push(Array.isArray(query) && self.isStreamFormatSupported(query[0], query[1]));
+        }
+
+        return {
+            version: CYIBitmovinVideoPlayer.getVersion(),
+            supported: supported
+        };
+    }
+
     clearStreamFormats() {
         const self = this;
 
@@ -3361,11 +3894,22 @@ class CYIBitmovinVideoPlayer {
         self.sendEvent("bufferingStateChanged", buffering);
     }
 
-    notifyVideoTimeChanged() {
+    notifyVideoTimeChanged(periodic) {
         const self = this;
 
         self.checkInitialized();
 
+        // periodic updates are throttled at the source to the cadence requested by the native player, an interval of 0 disables them
+        if(periodic) {
+            const nowMs = window.performance.now();
+
+            if(self.videoTimeIntervalMs === 0 || nowMs - self.lastVideoTimeNotificationMs < self.videoTimeIntervalMs) {
+                return;
+            }
+
+            self.lastVideoTimeNotificationMs = nowMs;
+        }
+
         const bufferedTimeRanges = self.video.buffered;
         let bufferedTimeRange = null;
 
@@ -3380,24 +3924,46 @@ class CYIBitmovinVideoPlayer {
             }
         }
 
-        const data = {
-            currentTimeSeconds: self.getCurrentTime()
-        };
+        const currentTimeSeconds = self.getCurrentTime();
+        let bufferStartMs = 0;
+        let bufferEndMs = 0;
+        let bufferLengthMs = 0;
 
         if(CYIUtilities.isValid(bufferedTimeRange)) {
-            data.bufferStartMs = Math.floor(bufferedTimeRange.start * 1000);
-            data.bufferEndMs = Math.floor(bufferedTimeRange.end * 1000);
-            data.bufferLengthMs = Math.floor((bufferedTimeRange.end - self.video.currentTime) * 1000);
+            bufferStartMs = Math.floor(bufferedTimeRange.start * 1000);
+            bufferEndMs = Math.floor(bufferedTimeRange.end * 1000);
+            bufferLengthMs = Math.floor((bufferedTimeRange.end - self.video.currentTime) * 1000);
         }
-        else {
-            data.bufferStartMs = 0;
-            data.bufferEndMs = 0;
-            data.bufferLengthMs = 0;
+
+        // note: time updates are the highest volume events, so by default they are sent as a packed array with a fixed layout
+        if(self.packedTelemetry) {
+            const packedData = [];
+            packedData[CYIBitmovinVideoPlayer.VideoTimeLayout.CurrentTimeSeconds] = currentTimeSeconds;
+            packedData[CYIBitmovinVideoPlayer.VideoTimeLayout.BufferStartMs] = bufferStartMs;
+            packedData[CYIBitmovinVideoPlayer.VideoTimeLayout.BufferEndMs] = bufferEndMs;
+            packedData[CYIBitmovinVideoPlayer.VideoTimeLayout.BufferLengthMs] = bufferLengthMs;
+
+            return self.sendEvent("videoTimeChanged", packedData);
         }
 
+        const data = {
+            currentTimeSeconds: currentTimeSeconds,
+            bufferStartMs: bufferStartMs,
+            bufferEndMs: bufferEndMs,
+            bufferLengthMs: bufferLengthMs
+        };
+
         self.sendEvent("videoTimeChanged", data);
     }
 
+    notifySeekCompleted() {
+        const self = this;
+
+        self.checkInitialized();
+
+        self.sendEvent("seekCompleted", self.getCurrentTime());
+    }
+
     notifyVideoDurationChanged() {
         const self = this;
 
@@ -3450,6 +4016,35 @@ class CYIBitmovinVideoPlayer {
         self.sendEvent("textTrackStatusChanged", self.isTextTrackEnabled());
     }
 
+    notifyMuteStatusChanged() {
+        const self = this;
+
+        self.checkInitialized();
+
+        self.sendEvent("muteStatusChanged", self.isMuted());
+    }
+
+    notifyStateSnapshot() {
+        const self = this;
+
+        if(!self.initialized) {
+            return;
+        }
+
+        self.stateSnapshotVersion++;
+
+        // note: a full snapshot of the mirrored player state is sent after each state transition in case any individual change events were missed
+        self.sendEvent("stateSnapshot", {
+            version: self.stateSnapshotVersion,
+            state: self.state.id,
+            nickname: self.nickname,
+            muted: self.isMuted(),
+            textTrackEnabled: self.isTextTrackEnabled(),
+            activeAudioTrack: self.getActiveAudioTrack(),
+            activeTextTrack: self.getActiveTextTrack()
+        });
+    }
+
     notifyMetadataAvailable(identifier, value, timestamp, durationMs) {
         const self = this;
 
@@ -3481,16 +4076,23 @@ class CYIBitmovinVideoPlayer {
     }
 
     sendEvent(eventName, data) {
+        const self = this;
+
+        // a pre-warmed player which no native player has attached to yet has no instance ID, so its events are not routed to any player
         return CYIMessaging.sendEvent({
             context: CYIBitmovinVideoPlayer.name,
+            instanceId: self.instanceId,
             name: eventName,
             data: data
         });
     }
 
     sendErrorEvent(eventName, error) {
+        const self = this;
+
         return CYIMessaging.sendEvent({
             context: CYIBitmovinVideoPlayer.name,
+            instanceId: self.instanceId,
             name: eventName,
             error: error
         });
@@ -3567,6 +4169,31 @@ Object.defineProperty(CYIBitmovinVideoPlayer, "ExternalTrackPrefix", {
     enumerable: true
 });
 
+Object.defineProperty(CYIBitmovinVideoPlayer, "VideoTimeLayout", {
+    value: Object.freeze({
+        CurrentTimeSeconds: 0,
+        BufferStartMs: 1,
+        BufferEndMs: 2,
+        BufferLengthMs: 3
+    }),
+    enumerable: true
+});
+
+Object.defineProperty(CYIBitmovinVideoPlayer, "DefaultVideoTimeIntervalMs", {
+    value: 250,
+    enumerable: true
+});
+
+Object.defineProperty(CYIBitmovinVideoPlayer, "MaximumPreloadedSourceCount", {
+    value: 3,
+    enumerable: true
+});
+
+Object.defineProperty(CYIBitmovinVideoPlayer, "PreloadedProgressiveByteCount", {
+    value: 1048576,
+    enumerable: true
+});
+
 Object.defineProperty(CYIBitmovinVideoPlayer, "State", {
     enumerable: true,
     value: CYIBitmovinVideoPlayerState
@@ -140,18 +140,24 @@ CYIRemoteLogger.initialize = function initialize() {
 
 	CYIRemoteLogger.initialized = true;
 
-	if(typeof CYIMessaging !== "undefined") {
-		CYIMessaging.sendEvent({
-			context: CYIRemoteLogger.name,
-			name: "initialized"
-		});
-	}
+	CYIRemoteLogger.sendInitializedEvent();
 
 	CYIRemoteLogger.sendDebugRemoteLog("Tizen remote logger initialized successfully!");
 
 	return true;
 };
 
+CYIRemoteLogger.sendInitializedEvent = function sendInitializedEvent() {
+	if(typeof CYIMessaging === "undefined") {
+		return;
+	}
+
+	CYIMessaging.sendEvent({
+		context: CYIRemoteLogger.name,
+		name: "initialized"
+	});
+};
+
 CYIRemoteLogger.initializeMetadataHeaders = function initializeMetadataHeaders() {
 	if(CYIRemoteLogger.metadataHeaders) {
 		return;
@@ -186,6 +192,11 @@ CYIRemoteLogger.initializeMetadataHeaders = function initializeMetadataHeaders()
 };
 
 CYIRemoteLogger.onLogSinkInitialized = function onLogSinkInitialized() {
+	// the native log sink spools its messages until the remote logger is initialized, which may have happened before the sink was created
+	if(CYIRemoteLogger.initialized) {
+		CYIRemoteLogger.sendInitializedEvent();
+	}
+
 	if(CYIRemoteLogger.logSinkInitialized) {
 		return;
 	}
@@ -564,6 +575,23 @@ CYIRemoteLogger.remoteLog = function remoteLog(type, args) {
 	}
 };
 
+CYIRemoteLogger.remoteLogBatch = function remoteLogBatch(logMessages) {
+	// log messages from the native log sink are sent over the bridge in bulk as an array of [type, message] pairs
+	if(!Array.isArray(logMessages)) {
+		return;
+	}
+
+	for(var i = 0; i < logMessages.length; i++) {
+		var logMessage = logMessages[i];
+
+		if(!Array.isArray(logMessage) || logMessage.length < 2) {
+			continue;
+		}
+
+		CYIRemoteLogger.remoteLog(logMessage[0], [logMessage[1]]);
+	}
+};
+
 CYIRemoteLogger.sendRemoteLog = function sendRemoteLog(messageData) {
 	// check that the remote logger is enabled and initialized
 	if(!CYIRemoteLogger.enabled || !CYIRemoteLogger.initialized) {
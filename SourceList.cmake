@@ -7,20 +7,86 @@ set(HEADERS_IOS
 )
 
 set(SOURCE_TIZEN-NACL
+    src/BitmovinCommandAllocationTest.cpp
     src/YiTizenNaClRemoteLoggerSink.cpp
+    src/YiBitmovinBitrateHistory.cpp
+    src/YiBitmovinBridgeRecorder.cpp
+    src/YiBitmovinBridgeReplayer.cpp
+    src/YiBitmovinBridgeScheduler.cpp
+    src/YiBitmovinBridgeTransport.cpp
+    src/YiBitmovinCommandPipeline.cpp
+    src/YiBitmovinEventDispatcher.cpp
+    src/YiBitmovinLatencyRecorder.cpp
+    src/YiBitmovinLogRingBuffer.cpp
+    src/YiBitmovinPlayheadClock.cpp
+    src/YiBitmovinQoEMetrics.cpp
+    src/YiBitmovinStatisticsSnapshot.cpp
     src/YiBitmovinVideoPlayer.cpp
     src/YiBitmovinVideoSurface.cpp
     src/YiTizenNaClRemoteLoggerSink.cpp
 )
 
 set(HEADERS_TIZEN-NACL
+    src/BitmovinCommandAllocationTest.h
     src/YiTizenNaClRemoteLoggerSink.h
+    src/YiBitmovinBitrateHistory.h
+    src/YiBitmovinBridgeRecorder.h
+    src/YiBitmovinBridgeReplayer.h
+    src/YiBitmovinBridgeScheduler.h
+    src/YiBitmovinBridgeTransport.h
+    src/YiBitmovinCommandPipeline.h
+    src/YiBitmovinEventDispatcher.h
+    src/YiBitmovinLatencyRecorder.h
+    src/YiBitmovinLogRingBuffer.h
+    src/YiBitmovinPlayheadClock.h
+    src/YiBitmovinQoEMetrics.h
+    src/YiBitmovinStatisticsSnapshot.h
     src/YiBitmovinVideoPlayer.h
     src/YiBitmovinVideoPlayerPriv.h
     src/YiBitmovinVideoSurface.h
     src/YiTizenNaClRemoteLoggerSink.h
 )
 
+# note: only built with YI_BITMOVIN_SIMULATOR, the default Linux build uses the default video player
+set(SOURCE_BITMOVIN_SIMULATOR
+    src/BitmovinCommandAllocationTest.cpp
+    src/YiBitmovinBitrateHistory.cpp
+    src/YiBitmovinBridgeRecorder.cpp
+    src/YiBitmovinBridgeReplayer.cpp
+    src/YiBitmovinBridgeScheduler.cpp
+    src/YiBitmovinBridgeTransport.cpp
+    src/YiBitmovinCommandPipeline.cpp
+    src/YiBitmovinEventDispatcher.cpp
+    src/YiBitmovinLatencyRecorder.cpp
+    src/YiBitmovinLogRingBuffer.cpp
+    src/YiBitmovinPlayheadClock.cpp
+    src/YiBitmovinQoEMetrics.cpp
+    src/YiBitmovinSimulatedBridgeTransport.cpp
+    src/YiBitmovinStatisticsSnapshot.cpp
+    src/YiBitmovinVideoPlayer.cpp
+    src/YiBitmovinVideoSurface.cpp
+)
+
+set(HEADERS_BITMOVIN_SIMULATOR
+    src/BitmovinCommandAllocationTest.h
+    src/YiBitmovinBitrateHistory.h
+    src/YiBitmovinBridgeRecorder.h
+    src/YiBitmovinBridgeReplayer.h
+    src/YiBitmovinBridgeScheduler.h
+    src/YiBitmovinBridgeTransport.h
+    src/YiBitmovinCommandPipeline.h
+    src/YiBitmovinEventDispatcher.h
+    src/YiBitmovinLatencyRecorder.h
+    src/YiBitmovinLogRingBuffer.h
+    src/YiBitmovinPlayheadClock.h
+    src/YiBitmovinQoEMetrics.h
+    src/YiBitmovinSimulatedBridgeTransport.h
+    src/YiBitmovinStatisticsSnapshot.h
+    src/YiBitmovinVideoPlayer.h
+    src/YiBitmovinVideoPlayerPriv.h
+    src/YiBitmovinVideoSurface.h
+)
+
 set (YI_PROJECT_SOURCE
     src/AutomatedPlayerTesterApp.cpp
     src/IStreamPlanetFairPlayHandler.cpp
@@ -35,3 +101,8 @@ set (YI_PROJECT_HEADERS
     src/PlayerTesterApp.h
     ${HEADERS_${YI_PLATFORM_UPPER}}
 )
+
+if(YI_BITMOVIN_SIMULATOR AND YI_PLATFORM_UPPER STREQUAL "LINUX")
+    list(APPEND YI_PROJECT_SOURCE ${SOURCE_BITMOVIN_SIMULATOR})
+    list(APPEND YI_PROJECT_HEADERS ${HEADERS_BITMOVIN_SIMULATOR})
+endif()
@@ -1,5 +1,9 @@
 #include "AutomatedPlayerTesterApp.h"
 
+#if defined(YI_TIZEN_NACL) || defined(YI_BITMOVIN_SIMULATOR)
+#include "BitmovinCommandAllocationTest.h"
+#endif
+
 #include <framework/YiAppContext.h>
 #include <player/YiAbstractVideoPlayer.h>
 #include <player/YiDefaultVideoPlayerFactory.h>
@@ -262,6 +266,21 @@ void AutomatedPlayerTesterApp::PlayerTest::DoStep()
         m_pVideoPlayer->Seek(seekWithThisValue);
         // StepCompleted will be emitted once the video starts playing again.
     }
+#if defined(YI_TIZEN_NACL) || defined(YI_BITMOVIN_SIMULATOR)
+    else if (actionToPerform == ACTION_COUNT_COMMAND_ALLOCATIONS)
+    {
+        CYIString failureMessage;
+        if (BitmovinCommandAllocationTest::Run(failureMessage))
+        {
+            SetResult(true);
+        }
+        else
+        {
+            SetResult(false, failureMessage);
+        }
+        StepCompleted.Emit();
+    }
+#endif
     else
     {
         //Unknown step
@@ -990,6 +1009,17 @@ void AutomatedPlayerTesterApp::InitializeTests()
             m_PlayerTests.push_back(std::move(liveTest));
         }
     }
+
+#if defined(YI_TIZEN_NACL) || defined(YI_BITMOVIN_SIMULATOR)
+    /* BRIDGE TESTS
+     These tests do not play a video. Commands are sent to the Bitmovin bridge through a transport which answers them immediately, and the test fails if sending a command allocates once the command pipeline has warmed up.
+     */
+    {
+        std::unique_ptr<PlayerTest> bridgeTest = std::make_unique<PlayerTest>(*this, "Bridge Test: Commands do not allocate after warm-up", "BridgeTest");
+        bridgeTest->AddTestStep(PlayerTest::TestStep(ACTION_COUNT_COMMAND_ALLOCATIONS, EVALUATOR_NONE));
+        m_PlayerTests.push_back(std::move(bridgeTest));
+    }
+#endif
 }
 
 void AutomatedPlayerTesterApp::StartAutomatedTestSuite()
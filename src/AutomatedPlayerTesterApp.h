@@ -34,6 +34,7 @@ static const uint16_t ACTION_SEEK_TO_LOWEST_SEEKABLE_STARTTIME = 21;
 static const uint16_t ACTION_SEEK_TO_HIGHEST_SEEKABLE_ENDTIME = 22;
 static const uint16_t ACTION_SEEK_BELOW_LOWEST_SEEKABLE_STARTTIME = 23;
 static const uint16_t ACTION_SEEK_ABOVE_HIGHEST_SEEKABLE_ENDTIME = 24;
+static const uint16_t ACTION_COUNT_COMMAND_ALLOCATIONS = 25;
 
 static const uint16_t EVALUATOR_NONE = 0; // For actions that can be done immediately, then move on to next
 static const uint16_t EVALUATOR_EXPECTED_ERROR = 1;
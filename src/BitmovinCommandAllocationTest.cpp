@@ -0,0 +1,211 @@
+#include "BitmovinCommandAllocationTest.h"
+
+#include "YiBitmovinBridgeScheduler.h"
+#include "YiBitmovinBridgeTransport.h"
+#include "YiBitmovinCommandPipeline.h"
+#include "YiBitmovinLatencyRecorder.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#define LOG_TAG "BitmovinCommandAllocationTest"
+
+#if defined(YI_AUTO_TESTS)
+static const char *TEST_CLASS_NAME = "BitmovinCommandAllocationTest";
+static const char *TEST_INSTANCE_ACCESSOR_NAME = "allocationTest";
+static const char *TEST_FUNCTION_NAME = "setVolume";
+static const char *EXECUTE_COMMAND_BATCH_FUNCTION_NAME = "executeCommandBatch";
+static const size_t WARM_UP_ITERATION_COUNT = 64;
+static const size_t MEASURED_ITERATION_COUNT = 1024;
+static const size_t BATCH_SIZE = 2;
+
+// note: only allocations made on the thread running the test while counting is enabled are counted, other engine threads keep allocating
+static thread_local bool s_countAllocations = false;
+static thread_local size_t s_allocationCount = 0;
+
+static void *Allocate(size_t size)
+{
+    if (s_countAllocations)
+    {
+        s_allocationCount++;
+    }
+
+    void *pMemory = std::malloc(size > 0 ? size : 1);
+
+    if (!pMemory)
+    {
+        throw std::bad_alloc();
+    }
+
+    return pMemory;
+}
+
+void *operator new(size_t size)
+{
+    return Allocate(size);
+}
+
+void *operator new[](size_t size)
+{
+    return Allocate(size);
+}
+
+void operator delete(void *pMemory) noexcept
+{
+    std::free(pMemory);
+}
+
+void operator delete[](void *pMemory) noexcept
+{
+    std::free(pMemory);
+}
+
+void operator delete(void *pMemory, size_t) noexcept
+{
+    std::free(pMemory);
+}
+
+void operator delete[](void *pMemory, size_t) noexcept
+{
+    std::free(pMemory);
+}
+
+// answers every call before returning with a canned result, which the transport contract allows, so that the only allocations left are the
+// ones made by the pipeline and the scheduler
+class ImmediateResponseTransport : public CYIBitmovinBridgeTransport
+{
+public:
+    ImmediateResponseTransport()
+        : m_batchResult(yi::rapidjson::kArrayType)
+    {
+        for (size_t i = 0; i < BATCH_SIZE; i++)
+        {
+            yi::rapidjson::Value commandResultValue(yi::rapidjson::kObjectType);
+            commandResultValue.AddMember("result", yi::rapidjson::Value(true), m_batchResult.GetAllocator());
+            m_batchResult.PushBack(commandResultValue, m_batchResult.GetAllocator());
+        }
+    }
+
+    virtual bool IsConnected() const override
+    {
+        return true;
+    }
+
+    virtual bool Call(Target, const char *, const char *, const char *pFunctionName, yi::rapidjson::Document &&, yi::rapidjson::Value &&, CYISignalHandler *pResponseHandlerOwner, ResponseHandler &&responseHandler) override
+    {
+        if (pResponseHandlerOwner && responseHandler)
+        {
+            Response response;
+            response.pResult = std::strcmp(pFunctionName, EXECUTE_COMMAND_BATCH_FUNCTION_NAME) == 0 ? &m_batchResult : &m_result;
+
+            responseHandler(response);
+        }
+
+        return true;
+    }
+
+    virtual CallStatus CallAndWait(Target, const char *, const char *, const char *, yi::rapidjson::Document &&, yi::rapidjson::Value &&, uint64_t, const ResponseHandler &) override
+    {
+        return CallStatus::NotSent;
+    }
+
+    virtual uint64_t RegisterEventHandler(const CYIString &, EventHandler &&) override
+    {
+        return 0;
+    }
+
+    virtual void UnregisterEventHandler(uint64_t) override
+    {
+    }
+
+private:
+    yi::rapidjson::Value m_result;
+    yi::rapidjson::Document m_batchResult;
+};
+
+static void SendCommands(CYIBitmovinCommandPipeline &commandPipeline, size_t commandCount, size_t &completedCommandCount)
+{
+    for (size_t i = 0; i < commandCount; i++)
+    {
+        yi::rapidjson::Document command(commandPipeline.CreateCommand());
+        yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
+        arguments.PushBack(yi::rapidjson::Value(0.5), command.GetAllocator());
+
+        commandPipeline.Send(CYIBitmovinCommandPipeline::Target::Instance, TEST_FUNCTION_NAME, std::move(command), std::move(arguments), [&completedCommandCount](const CYIBitmovinCommandPipeline::Result &result) {
+            if (result.success)
+            {
+                completedCommandCount++;
+            }
+        }, CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, true);
+    }
+
+    commandPipeline.Flush();
+}
+#endif
+
+bool BitmovinCommandAllocationTest::Run(CYIString &failureMessage)
+{
+#if !defined(YI_AUTO_TESTS)
+    failureMessage = "Allocations are only counted in builds with YI_AUTO_TESTS defined.";
+    return false;
+#else
+    ImmediateResponseTransport transport;
+    CYIBitmovinBridgeTransport *pPreviousTransport = CYIBitmovinBridgeTransport::GetInstance();
+    CYIBitmovinBridgeTransport::SetInstance(&transport);
+
+    bool succeeded = true;
+
+    {
+        CYIBitmovinLatencyRecorder latencyRecorder;
+        CYIBitmovinCommandPipeline commandPipeline(TEST_CLASS_NAME, TEST_INSTANCE_ACCESSOR_NAME);
+        commandPipeline.SetLatencyRecorder(&latencyRecorder);
+        commandPipeline.SetFailureCallback([](const char *pFunctionName, const CYIBitmovinCommandPipeline::Result &result) {
+            YI_LOGE(LOG_TAG, "%s failed: %s", pFunctionName, result.errorMessage.GetData());
+        });
+
+        size_t completedCommandCount = 0;
+
+        // the first commands size the arena, the pending command lists and the latency histogram, which are then reused
+        for (size_t i = 0; i < WARM_UP_ITERATION_COUNT; i++)
+        {
+            SendCommands(commandPipeline, 1, completedCommandCount);
+            SendCommands(commandPipeline, BATCH_SIZE, completedCommandCount);
+        }
+
+        completedCommandCount = 0;
+        s_allocationCount = 0;
+        s_countAllocations = true;
+
+        for (size_t i = 0; i < MEASURED_ITERATION_COUNT; i++)
+        {
+            SendCommands(commandPipeline, 1, completedCommandCount);
+            SendCommands(commandPipeline, BATCH_SIZE, completedCommandCount);
+        }
+
+        s_countAllocations = false;
+
+        size_t expectedCommandCount = MEASURED_ITERATION_COUNT * (1 + BATCH_SIZE);
+
+        if (completedCommandCount != expectedCommandCount)
+        {
+            char message[128];
+            snprintf(message, sizeof(message), "Expected %zu commands to complete, but %zu did.", expectedCommandCount, completedCommandCount);
+            failureMessage = message;
+            succeeded = false;
+        }
+        else if (s_allocationCount > 0)
+        {
+            char message[128];
+            snprintf(message, sizeof(message), "Expected no allocations after warming up, but %zu were made for %zu commands.", s_allocationCount, expectedCommandCount);
+            failureMessage = message;
+            succeeded = false;
+        }
+    }
+
+    CYIBitmovinBridgeTransport::SetInstance(pPreviousTransport);
+
+    return succeeded;
+#endif
+}
@@ -0,0 +1,15 @@
+#ifndef _BITMOVIN_COMMAND_ALLOCATION_TEST_H_
+#define _BITMOVIN_COMMAND_ALLOCATION_TEST_H_
+
+#include <utility/YiString.h>
+
+// note: sends commands through a command pipeline, the bridge scheduler and a transport which answers every call immediately, and counts
+// the heap allocations made on the calling thread once the pipeline has warmed up. Single commands and command batches are both covered.
+// note: allocations are only counted in builds with YI_AUTO_TESTS defined, since counting replaces the global operator new
+class BitmovinCommandAllocationTest
+{
+public:
+    static bool Run(CYIString &failureMessage);
+};
+
+#endif // _BITMOVIN_COMMAND_ALLOCATION_TEST_H_
@@ -37,15 +37,25 @@
 #include <view/YiSceneView.h>
 #include <view/YiTextEditView.h>
 
+#include <limits>
+
 #if defined(YI_TIZEN_NACL)
 #    include <player/YiTizenNaClVideoPlayer.h>
 
+#    include "YiBitmovinBridgeScheduler.h"
 #    include "YiBitmovinVideoPlayer.h"
 #    include "YiTizenNaClRemoteLoggerSink.h"
+#elif defined(YI_BITMOVIN_SIMULATOR)
+#    include "YiBitmovinBridgeReplayer.h"
+#    include "YiBitmovinBridgeScheduler.h"
+#    include "YiBitmovinSimulatedBridgeTransport.h"
+#    include "YiBitmovinVideoPlayer.h"
 #endif
 
 #define LOG_TAG "PlayerTesterApp"
 
+static const uint64_t INVALID_STATISTICS_GENERATION = std::numeric_limits<uint64_t>::max();
+
 class BufferingController : public CYISignalHandler
 {
 public:
@@ -91,6 +101,22 @@ public:
     }
 };
 
+#if defined(YI_TIZEN_NACL) || defined(YI_BITMOVIN_SIMULATOR)
+static yi::rapidjson::Document CreateBitmovinPlayerConfiguration()
+{
+    yi::rapidjson::Document playerConfiguration(yi::rapidjson::kObjectType);
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = playerConfiguration.GetAllocator();
+    yi::rapidjson::Value apiKeyValue("", allocator);
+    yi::rapidjson::Value appIdValue("", allocator);
+    playerConfiguration.AddMember(yi::rapidjson::StringRef("apiKey"), apiKeyValue, allocator);
+    playerConfiguration.AddMember(yi::rapidjson::StringRef("appId"), appIdValue, allocator);
+#if YI_DEBUG
+    playerConfiguration.AddMember(yi::rapidjson::StringRef("verbose"), yi::rapidjson::Value(true), allocator);
+#endif
+    return playerConfiguration;
+}
+#endif // YI_TIZEN_NACL || YI_BITMOVIN_SIMULATOR
+
 static void ConfigureCapabilities(CYIVideoSurface *pSurface, CYITextSceneNode *pTextNode)
 {
     CYIString text;
@@ -212,6 +238,7 @@ PlayerTesterApp::PlayerTesterApp()
     , m_pMinBufferLengthStatText(nullptr)
     , m_pMaxBufferLengthStatText(nullptr)
     , m_pFPSText(nullptr)
+    , m_displayedStatisticsGeneration(INVALID_STATISTICS_GENERATION)
     , m_pCurrentUrlText(nullptr)
     , m_pCurrentFormatText(nullptr)
     , m_pSeekText(nullptr)
@@ -227,15 +254,41 @@ PlayerTesterApp::PlayerTesterApp()
 #endif
 {
 #if defined(YI_TIZEN_NACL)
-  CYILogger::AddSink(std::make_shared<CYITizenNaClRemoteLoggerSink>());
+  m_pRemoteLoggerSink = std::make_shared<CYITizenNaClRemoteLoggerSink>();
+  CYILogger::AddSink(m_pRemoteLoggerSink);
 #endif // YI_TIZEN_NACL
 }
 
 PlayerTesterApp::~PlayerTesterApp()
 {
     GetMasterAppSceneManager()->RemoveScene("Main");
+
+#if (defined(YI_TIZEN_NACL) || defined(YI_BITMOVIN_SIMULATOR)) && YI_DEBUG
+    CYIBitmovinVideoPlayer *pBitmovinPlayer = YiDynamicCast<CYIBitmovinVideoPlayer>(m_pPlayer.get());
+    if (pBitmovinPlayer)
+    {
+        pBitmovinPlayer->ExportBitrateHistory(GetDataPath() + "/BitmovinBitrateHistory.csv");
+    }
+#endif // (YI_TIZEN_NACL || YI_BITMOVIN_SIMULATOR) && YI_DEBUG
+
     m_pPlayer.reset();
 
+#if defined(YI_TIZEN_NACL) || defined(YI_BITMOVIN_SIMULATOR)
+    CYIBitmovinVideoPlayer::StopBridgeRecording();
+    CYIBitmovinVideoPlayer::ReleasePrewarm();
+#if YI_DEBUG
+    CYIBitmovinVideoPlayer::DumpBridgeLatencyStatistics(GetDataPath() + "/BitmovinBridgeLatency.csv");
+#endif
+
+#if defined(YI_TIZEN_NACL)
+    // the sink queues log messages on the bridge scheduler, so it is removed before the scheduler is shut down
+    CYILogger::RemoveSink(m_pRemoteLoggerSink);
+    m_pRemoteLoggerSink.reset();
+#endif
+
+    CYIBitmovinBridgeScheduler::Shutdown();
+#endif // YI_TIZEN_NACL || YI_BITMOVIN_SIMULATOR
+
     delete m_pBufferingController;
     m_pBufferingController = nullptr;
 #if defined(YI_IOS)
@@ -254,6 +307,30 @@ bool PlayerTesterApp::UserInit()
 {
     CYIEventDispatcher::GetDefaultDispatcher()->RegisterEventHandler(this);
 
+#if defined(YI_TIZEN_NACL) || defined(YI_BITMOVIN_SIMULATOR)
+#if defined(YI_BITMOVIN_SIMULATOR)
+    // simulator builds have no web messaging bridge, so the Bitmovin player is driven by a simulated JS player for benchmarking and regression
+    // testing, or by a capture recorded on a device when one is present in the data directory
+    CYIBitmovinBridgeReplayer *pBridgeReplayer = new CYIBitmovinBridgeReplayer();
+    if (pBridgeReplayer->Load(GetDataPath() + "/BitmovinBridgeReplay.bin"))
+    {
+        m_pBridgeTransport.reset(pBridgeReplayer);
+    }
+    else
+    {
+        delete pBridgeReplayer;
+        pBridgeReplayer = nullptr;
+        m_pBridgeTransport.reset(new CYIBitmovinSimulatedBridgeTransport());
+    }
+    CYIBitmovinBridgeTransport::SetInstance(m_pBridgeTransport.get());
+#endif
+#if defined(YI_BITMOVIN_BRIDGE_RECORDING)
+    CYIBitmovinVideoPlayer::StartBridgeRecording(GetDataPath() + "/BitmovinBridgeCapture.bin");
+#endif
+    // the JS player is constructed while the scene loads, the player created below attaches to it
+    CYIBitmovinVideoPlayer::Prewarm(CreateBitmovinPlayerConfiguration());
+#endif // YI_TIZEN_NACL || YI_BITMOVIN_SIMULATOR
+
     std::unique_ptr<CYISceneView> pOwnedMainComposition = GetMasterAppSceneManager()->LoadScene("PlayerTester_MainComp.layout", CYISceneManager::ScaleType::Fit, CYISceneManager::VerticalAlignmentType::Center, CYISceneManager::HorizontalAlignmentType::Center);
 
     CYISceneView *pMainComposition = pOwnedMainComposition.get();
@@ -272,21 +349,26 @@ bool PlayerTesterApp::UserInit()
     GetMasterAppSceneManager()->StageScene("Main");
 
     // we can't instansiate the player in the constructor because on Android the CYIActivity is not available yet
-#if defined(YI_TIZEN_NACL)
-    yi::rapidjson::Document playerConfiguration(yi::rapidjson::kObjectType);
-    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = playerConfiguration.GetAllocator();
-    yi::rapidjson::Value apiKeyValue("", allocator);
-    yi::rapidjson::Value appIdValue("", allocator);
-    playerConfiguration.AddMember(yi::rapidjson::StringRef("apiKey"), apiKeyValue, allocator);
-    playerConfiguration.AddMember(yi::rapidjson::StringRef("appId"), appIdValue, allocator);
-#if YI_DEBUG
-    playerConfiguration.AddMember(yi::rapidjson::StringRef("verbose"), yi::rapidjson::Value(true), allocator);
-#endif
-    m_pPlayer = std::unique_ptr<CYIBitmovinVideoPlayer>(CYIBitmovinVideoPlayer::Create(std::move(playerConfiguration)));
+#if defined(YI_TIZEN_NACL) || defined(YI_BITMOVIN_SIMULATOR)
+    CYIBitmovinVideoPlayer::SetCapabilityCacheFilePath(GetDataPath() + "/BitmovinCapabilities.json");
+    std::unique_ptr<CYIBitmovinVideoPlayer> pBitmovinPlayer(CYIBitmovinVideoPlayer::Create(CreateBitmovinPlayerConfiguration()));
+    if (pBitmovinPlayer)
+    {
+        pBitmovinPlayer->SeekCompleted.Connect([](const CYIBitmovinVideoPlayer::SeekTiming &seekTiming) {
+            YI_LOGI(LOG_TAG, "Seek to %llums completed in %lldms, %u intermediate seek request(s) dropped.", (long long unsigned)seekTiming.targetPositionMs, (long long)std::chrono::duration_cast<std::chrono::milliseconds>(seekTiming.completeTime - seekTiming.startTime).count(), seekTiming.coalescedSeekCount);
+        });
+    }
+    m_pPlayer = std::move(pBitmovinPlayer);
 #else
     m_pPlayer = CYIDefaultVideoPlayerFactory::Create();
-#endif // YI_TIZEN_NACL
+#endif // YI_TIZEN_NACL || YI_BITMOVIN_SIMULATOR
     m_pPlayer->Init();
+#if defined(YI_BITMOVIN_SIMULATOR)
+    if (pBridgeReplayer)
+    {
+        pBridgeReplayer->Start(CYIBitmovinBridgeReplayer::Mode::RealTime);
+    }
+#endif
     m_pPlayer->ErrorOccurred.Connect(*this, &PlayerTesterApp::ErrorOccured);
     m_pPlayer->Preparing.Connect(*this, &PlayerTesterApp::VideoPreparing);
     m_pPlayer->Ready.Connect(*this, &PlayerTesterApp::VideoReady);
@@ -676,7 +758,25 @@ void PlayerTesterApp::UserUpdate()
 {
     if (m_pPlayer)
     {
+#if defined(YI_TIZEN_NACL) || defined(YI_BITMOVIN_SIMULATOR)
+        // the Bitmovin player publishes its statistics as versioned snapshots, the labels only need updating when a new one is published
+        CYIBitmovinVideoPlayer *pBitmovinPlayer = YiDynamicCast<CYIBitmovinVideoPlayer>(m_pPlayer.get());
+        if (pBitmovinPlayer)
+        {
+            uint64_t statisticsGeneration = pBitmovinPlayer->GetStatisticsGeneration();
+            if (statisticsGeneration != m_displayedStatisticsGeneration)
+            {
+                m_displayedStatisticsGeneration = statisticsGeneration;
+                UpdatePlayerStats(pBitmovinPlayer->GetStatistics());
+            }
+        }
+        else
+        {
+            UpdatePlayerStats(m_pPlayer->GetStatistics());
+        }
+#else
         UpdatePlayerStats(m_pPlayer->GetStatistics());
+#endif
 
         CYIAbstractVideoPlayer::BufferingInterface *pBufferingInterface = m_pPlayer->GetBufferingInterface();
         if (pBufferingInterface)
@@ -1839,6 +1939,8 @@ bool PlayerTesterApp::AppendUrlIfSupported(UrlAndFormat urlAndFormat)
 
 void PlayerTesterApp::ResetStatisticsLabelsToDefault()
 {
+    m_displayedStatisticsGeneration = INVALID_STATISTICS_GENERATION;
+
     // reset statistics labels to default
     m_pIsLiveText->SetText("NO");
     m_pTotalBitrateText->SetText(CYIString::FromFloat(-1));
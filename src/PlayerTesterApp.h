@@ -18,6 +18,8 @@ class BufferingController;
 class IStreamPlanetFairPlayHandler;
 
 class CYIAbstractTimeline;
+class CYIBitmovinBridgeTransport;
+class CYILogSink;
 class CYIPushButtonView;
 class CYISceneView;
 class CYITextSceneNode;
@@ -132,6 +134,9 @@ private:
 
     void HandleSeek(uint64_t seekPositionMS);
 
+#if defined(YI_BITMOVIN_SIMULATOR)
+    std::unique_ptr<CYIBitmovinBridgeTransport> m_pBridgeTransport; // note: declared before the player so that it outlives it
+#endif
     std::unique_ptr<CYIAbstractVideoPlayer> m_pPlayer;
     CYIVideoSurfaceView *m_pPlayerSurfaceView;
     CYIVideoSurfaceView *m_pPlayerSurfaceMiniView;
@@ -180,6 +185,7 @@ private:
     CYITextSceneNode *m_pMinBufferLengthStatText;
     CYITextSceneNode *m_pMaxBufferLengthStatText;
     CYITextSceneNode *m_pFPSText;
+    uint64_t m_displayedStatisticsGeneration;
     CYITextEditView *m_pCurrentUrlText;
     CYITextEditView *m_pCurrentFormatText;
     CYITextEditView *m_pSeekText;
@@ -198,6 +204,10 @@ private:
 
     bool m_isMediaControlsHandlerSet;
 
+#if defined(YI_TIZEN_NACL)
+    std::shared_ptr<CYILogSink> m_pRemoteLoggerSink;
+#endif
+
 #if defined(YI_IOS)
     AirplayRoutePicker m_RoutePicker;
     void UpdateRouteButton();
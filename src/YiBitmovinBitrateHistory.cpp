@@ -0,0 +1,340 @@
+#include "YiBitmovinBitrateHistory.h"
+
+#include <logging/YiLogger.h>
+
+#include <algorithm>
+#include <fstream>
+
+#define LOG_TAG "CYIBitmovinBitrateHistory"
+
+static const char EXPORT_MAGIC[] = { 'Y', 'B', 'H', '1' };
+static const size_t EXPORT_MAGIC_SIZE = sizeof(EXPORT_MAGIC);
+
+const size_t CYIBitmovinBitrateHistory::SAMPLE_SIZE_BYTES = sizeof(uint64_t) + 4 * sizeof(float);
+
+// note: averages the samples which fall in one time bucket when downsampling, unknown values are left out of the column averages
+struct CYIBitmovinBitrateHistory::DownsamplingBucket
+{
+    struct ColumnAverage
+    {
+        double sum = 0.0;
+        uint32_t count = 0;
+
+        void Add(float value)
+        {
+            if (value >= 0.0f)
+            {
+                sum += value;
+                count++;
+            }
+        }
+
+        float Get() const
+        {
+            return count > 0 ? static_cast<float>(sum / count) : -1.0f;
+        }
+    };
+
+    uint64_t timeSumMs = 0;
+    uint32_t sampleCount = 0;
+    ColumnAverage videoBitrateKbps;
+    ColumnAverage audioBitrateKbps;
+    ColumnAverage totalBitrateKbps;
+    ColumnAverage bufferLengthMs;
+};
+
+template<typename T>
+static void WriteColumn(std::ofstream &stream, const std::vector<T> &column, size_t oldestIndex, size_t size)
+{
+    // the column is written in at most two contiguous runs, from the oldest sample to the end of the array and then from its start
+    size_t firstRunSize = std::min(size, column.size() - oldestIndex);
+
+    stream.write(reinterpret_cast<const char *>(column.data() + oldestIndex), static_cast<std::streamsize>(firstRunSize * sizeof(T)));
+    stream.write(reinterpret_cast<const char *>(column.data()), static_cast<std::streamsize>((size - firstRunSize) * sizeof(T)));
+}
+
+CYIBitmovinBitrateHistory::CYIBitmovinBitrateHistory(size_t memoryBudgetBytes)
+    : m_memoryBudgetBytes(0)
+    , m_capacity(0)
+    , m_oldestIndex(0)
+    , m_size(0)
+    , m_startTime(std::chrono::steady_clock::now())
+{
+    SetMemoryBudget(memoryBudgetBytes);
+}
+
+void CYIBitmovinBitrateHistory::SetMemoryBudget(size_t memoryBudgetBytes)
+{
+    size_t capacity = memoryBudgetBytes / SAMPLE_SIZE_BYTES;
+
+    m_memoryBudgetBytes = memoryBudgetBytes;
+
+    if (capacity == m_capacity)
+    {
+        return;
+    }
+
+    size_t keptSampleCount = std::min(m_size, capacity);
+    size_t firstKeptIndex = m_size - keptSampleCount;
+
+    std::vector<uint64_t> timesMs(capacity);
+    std::vector<float> videoBitratesKbps(capacity);
+    std::vector<float> audioBitratesKbps(capacity);
+    std::vector<float> totalBitratesKbps(capacity);
+    std::vector<float> bufferLengthsMs(capacity);
+
+    for (size_t i = 0; i < keptSampleCount; i++)
+    {
+        size_t physicalIndex = GetPhysicalIndex(firstKeptIndex + i);
+
+        timesMs[i] = m_timesMs[physicalIndex];
+        videoBitratesKbps[i] = m_videoBitratesKbps[physicalIndex];
+        audioBitratesKbps[i] = m_audioBitratesKbps[physicalIndex];
+        totalBitratesKbps[i] = m_totalBitratesKbps[physicalIndex];
+        bufferLengthsMs[i] = m_bufferLengthsMs[physicalIndex];
+    }
+
+    m_timesMs.swap(timesMs);
+    m_videoBitratesKbps.swap(videoBitratesKbps);
+    m_audioBitratesKbps.swap(audioBitratesKbps);
+    m_totalBitratesKbps.swap(totalBitratesKbps);
+    m_bufferLengthsMs.swap(bufferLengthsMs);
+
+    m_capacity = capacity;
+    m_oldestIndex = 0;
+    m_size = keptSampleCount;
+}
+
+size_t CYIBitmovinBitrateHistory::GetMemoryBudget() const
+{
+    return m_memoryBudgetBytes;
+}
+
+void CYIBitmovinBitrateHistory::Clear(std::chrono::steady_clock::time_point now)
+{
+    m_oldestIndex = 0;
+    m_size = 0;
+    m_startTime = now;
+}
+
+void CYIBitmovinBitrateHistory::AddSample(float videoBitrateKbps, float audioBitrateKbps, float totalBitrateKbps, float bufferLengthMs, std::chrono::steady_clock::time_point now)
+{
+    if (m_capacity == 0)
+    {
+        return;
+    }
+
+    size_t physicalIndex = 0;
+
+    if (m_size < m_capacity)
+    {
+        physicalIndex = GetPhysicalIndex(m_size);
+        m_size++;
+    }
+    else
+    {
+        physicalIndex = m_oldestIndex;
+        m_oldestIndex = (m_oldestIndex + 1) % m_capacity;
+    }
+
+    std::chrono::steady_clock::duration elapsed = now - m_startTime;
+
+    m_timesMs[physicalIndex] = elapsed.count() > 0 ? static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()) : 0;
+    m_videoBitratesKbps[physicalIndex] = videoBitrateKbps;
+    m_audioBitratesKbps[physicalIndex] = audioBitrateKbps;
+    m_totalBitratesKbps[physicalIndex] = totalBitrateKbps;
+    m_bufferLengthsMs[physicalIndex] = bufferLengthMs;
+}
+
+size_t CYIBitmovinBitrateHistory::GetSize() const
+{
+    return m_size;
+}
+
+size_t CYIBitmovinBitrateHistory::GetCapacity() const
+{
+    return m_capacity;
+}
+
+std::vector<CYIBitmovinVideoPlayer::BitrateSample> CYIBitmovinBitrateHistory::GetSamples(uint64_t startTimeMs, uint64_t endTimeMs) const
+{
+    std::vector<CYIBitmovinVideoPlayer::BitrateSample> samples;
+
+    for (size_t index = FindFirstIndexAtOrAfter(startTimeMs); index < m_size && m_timesMs[GetPhysicalIndex(index)] <= endTimeMs; index++)
+    {
+        samples.push_back(GetSample(index));
+    }
+
+    return samples;
+}
+
+std::vector<CYIBitmovinVideoPlayer::BitrateSample> CYIBitmovinBitrateHistory::GetDownsampledSamples(uint64_t startTimeMs, uint64_t endTimeMs, size_t maximumSampleCount) const
+{
+    std::vector<CYIBitmovinVideoPlayer::BitrateSample> samples;
+
+    if (maximumSampleCount == 0 || endTimeMs < startTimeMs)
+    {
+        return samples;
+    }
+
+    // the range is clamped to the recorded samples first, so that an open ended range does not leave most buckets empty
+    size_t firstIndex = FindFirstIndexAtOrAfter(startTimeMs);
+
+    if (firstIndex >= m_size)
+    {
+        return samples;
+    }
+
+    startTimeMs = m_timesMs[GetPhysicalIndex(firstIndex)];
+    endTimeMs = std::min(endTimeMs, m_timesMs[GetPhysicalIndex(m_size - 1)]);
+
+    uint64_t rangeMs = endTimeMs - startTimeMs + 1;
+    uint64_t bucketWidthMs = std::max<uint64_t>((rangeMs + maximumSampleCount - 1) / maximumSampleCount, 1);
+
+    DownsamplingBucket bucket;
+    uint64_t bucketIndex = 0;
+
+    for (size_t index = firstIndex; index <= m_size; index++)
+    {
+        size_t physicalIndex = index < m_size ? GetPhysicalIndex(index) : 0;
+        bool inRange = index < m_size && m_timesMs[physicalIndex] <= endTimeMs;
+        uint64_t sampleBucketIndex = inRange ? (m_timesMs[physicalIndex] - startTimeMs) / bucketWidthMs : 0;
+
+        if (bucket.sampleCount > 0 && (!inRange || sampleBucketIndex != bucketIndex))
+        {
+            CYIBitmovinVideoPlayer::BitrateSample sample;
+            sample.timeMs = bucket.timeSumMs / bucket.sampleCount;
+            sample.videoBitrateKbps = bucket.videoBitrateKbps.Get();
+            sample.audioBitrateKbps = bucket.audioBitrateKbps.Get();
+            sample.totalBitrateKbps = bucket.totalBitrateKbps.Get();
+            sample.bufferLengthMs = bucket.bufferLengthMs.Get();
+            samples.push_back(sample);
+
+            bucket = DownsamplingBucket();
+        }
+
+        if (!inRange)
+        {
+            break;
+        }
+
+        bucketIndex = sampleBucketIndex;
+        bucket.timeSumMs += m_timesMs[physicalIndex];
+        bucket.sampleCount++;
+        bucket.videoBitrateKbps.Add(m_videoBitratesKbps[physicalIndex]);
+        bucket.audioBitrateKbps.Add(m_audioBitratesKbps[physicalIndex]);
+        bucket.totalBitrateKbps.Add(m_totalBitratesKbps[physicalIndex]);
+        bucket.bufferLengthMs.Add(m_bufferLengthsMs[physicalIndex]);
+    }
+
+    return samples;
+}
+
+bool CYIBitmovinBitrateHistory::ExportToFile(const CYIString &filePath, CYIBitmovinVideoPlayer::BitrateHistoryFormat format) const
+{
+    switch (format)
+    {
+        case CYIBitmovinVideoPlayer::BitrateHistoryFormat::CSV:
+        {
+            return ExportToCSV(filePath);
+        }
+        case CYIBitmovinVideoPlayer::BitrateHistoryFormat::Binary:
+        {
+            return ExportToBinary(filePath);
+        }
+    }
+
+    return false;
+}
+
+size_t CYIBitmovinBitrateHistory::GetPhysicalIndex(size_t index) const
+{
+    size_t physicalIndex = m_oldestIndex + index;
+    return physicalIndex < m_capacity ? physicalIndex : physicalIndex - m_capacity;
+}
+
+size_t CYIBitmovinBitrateHistory::FindFirstIndexAtOrAfter(uint64_t timeMs) const
+{
+    size_t first = 0;
+    size_t last = m_size;
+
+    // sample times never decrease, so the samples can be searched in order of age
+    while (first < last)
+    {
+        size_t middle = first + (last - first) / 2;
+
+        if (m_timesMs[GetPhysicalIndex(middle)] < timeMs)
+        {
+            first = middle + 1;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+
+    return first;
+}
+
+CYIBitmovinVideoPlayer::BitrateSample CYIBitmovinBitrateHistory::GetSample(size_t index) const
+{
+    size_t physicalIndex = GetPhysicalIndex(index);
+
+    CYIBitmovinVideoPlayer::BitrateSample sample;
+    sample.timeMs = m_timesMs[physicalIndex];
+    sample.videoBitrateKbps = m_videoBitratesKbps[physicalIndex];
+    sample.audioBitrateKbps = m_audioBitratesKbps[physicalIndex];
+    sample.totalBitrateKbps = m_totalBitratesKbps[physicalIndex];
+    sample.bufferLengthMs = m_bufferLengthsMs[physicalIndex];
+    return sample;
+}
+
+bool CYIBitmovinBitrateHistory::ExportToCSV(const CYIString &filePath) const
+{
+    std::ofstream exportFile(filePath.GetData(), std::ios::out | std::ios::trunc);
+
+    if (!exportFile.is_open())
+    {
+        YI_LOGW(LOG_TAG, "Failed to write bitrate history file: %s", filePath.GetData());
+        return false;
+    }
+
+    exportFile << "time_ms,video_kbps,audio_kbps,total_kbps,buffer_ms\n";
+
+    for (size_t index = 0; index < m_size; index++)
+    {
+        size_t physicalIndex = GetPhysicalIndex(index);
+
+        exportFile << m_timesMs[physicalIndex] << ',' << m_videoBitratesKbps[physicalIndex] << ',' << m_audioBitratesKbps[physicalIndex] << ',' << m_totalBitratesKbps[physicalIndex] << ',' << m_bufferLengthsMs[physicalIndex] << '\n';
+    }
+
+    return exportFile.good();
+}
+
+bool CYIBitmovinBitrateHistory::ExportToBinary(const CYIString &filePath) const
+{
+    std::ofstream exportFile(filePath.GetData(), std::ios::out | std::ios::trunc | std::ios::binary);
+
+    if (!exportFile.is_open())
+    {
+        YI_LOGW(LOG_TAG, "Failed to write bitrate history file: %s", filePath.GetData());
+        return false;
+    }
+
+    uint64_t sampleCount = m_size;
+
+    // the columns are written one after the other in the byte order of the device, mirroring the in-memory layout
+    exportFile.write(EXPORT_MAGIC, EXPORT_MAGIC_SIZE);
+    exportFile.write(reinterpret_cast<const char *>(&sampleCount), sizeof(sampleCount));
+
+    if (m_size > 0)
+    {
+        WriteColumn(exportFile, m_timesMs, m_oldestIndex, m_size);
+        WriteColumn(exportFile, m_videoBitratesKbps, m_oldestIndex, m_size);
+        WriteColumn(exportFile, m_audioBitratesKbps, m_oldestIndex, m_size);
+        WriteColumn(exportFile, m_totalBitratesKbps, m_oldestIndex, m_size);
+        WriteColumn(exportFile, m_bufferLengthsMs, m_oldestIndex, m_size);
+    }
+
+    return exportFile.good();
+}
@@ -0,0 +1,64 @@
+#ifndef _YI_BITMOVIN_BITRATE_HISTORY_H_
+#define _YI_BITMOVIN_BITRATE_HISTORY_H_
+
+#include "YiBitmovinVideoPlayer.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// note: a fixed capacity ring buffer of bitrate and buffer length samples, stored as one array per column so that queries and exports
+// over a single column stay within contiguous memory. The capacity is derived from a memory budget and never grows, once full each new
+// sample replaces the oldest one.
+//
+// note: sample times are in milliseconds since the history was last cleared, and are expected to be recorded in order
+class CYIBitmovinBitrateHistory
+{
+public:
+    static const size_t SAMPLE_SIZE_BYTES;
+
+    CYIBitmovinBitrateHistory(size_t memoryBudgetBytes);
+
+    // note: keeps the most recent samples which fit within the new budget, a budget smaller than one sample disables recording
+    void SetMemoryBudget(size_t memoryBudgetBytes);
+    size_t GetMemoryBudget() const;
+
+    void Clear(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+    void AddSample(float videoBitrateKbps, float audioBitrateKbps, float totalBitrateKbps, float bufferLengthMs, std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+    size_t GetSize() const;
+    size_t GetCapacity() const;
+
+    // note: both ends of the range are inclusive
+    std::vector<CYIBitmovinVideoPlayer::BitrateSample> GetSamples(uint64_t startTimeMs, uint64_t endTimeMs) const;
+
+    // note: splits the range into equal time buckets and averages the samples in each one, skipping empty buckets. Unknown values, reported
+    // as -1, are left out of the averages.
+    std::vector<CYIBitmovinVideoPlayer::BitrateSample> GetDownsampledSamples(uint64_t startTimeMs, uint64_t endTimeMs, size_t maximumSampleCount) const;
+
+    bool ExportToFile(const CYIString &filePath, CYIBitmovinVideoPlayer::BitrateHistoryFormat format) const;
+
+private:
+    struct DownsamplingBucket;
+
+    size_t GetPhysicalIndex(size_t index) const;
+    size_t FindFirstIndexAtOrAfter(uint64_t timeMs) const;
+    CYIBitmovinVideoPlayer::BitrateSample GetSample(size_t index) const;
+    bool ExportToCSV(const CYIString &filePath) const;
+    bool ExportToBinary(const CYIString &filePath) const;
+
+    size_t m_memoryBudgetBytes;
+    size_t m_capacity;
+    size_t m_oldestIndex;
+    size_t m_size;
+    std::chrono::steady_clock::time_point m_startTime;
+
+    std::vector<uint64_t> m_timesMs;
+    std::vector<float> m_videoBitratesKbps;
+    std::vector<float> m_audioBitratesKbps;
+    std::vector<float> m_totalBitratesKbps;
+    std::vector<float> m_bufferLengthsMs;
+};
+
+#endif // _YI_BITMOVIN_BITRATE_HISTORY_H_
@@ -0,0 +1,341 @@
+#include "YiBitmovinBridgeRecorder.h"
+
+#include <logging/YiLogger.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#define LOG_TAG "CYIBitmovinBridgeRecorder"
+
+static const char CAPTURE_MAGIC[] = { 'Y', 'B', 'R', '1' };
+static const size_t CAPTURE_MAGIC_SIZE = sizeof(CAPTURE_MAGIC);
+static const uint64_t MAX_PAYLOAD_SIZE = 64 * 1024 * 1024;
+
+const char *CYIBitmovinBridgeRecorder::CALL_TARGET_ATTRIBUTE_NAME = "target";
+const char *CYIBitmovinBridgeRecorder::CALL_CLASS_NAME_ATTRIBUTE_NAME = "className";
+const char *CYIBitmovinBridgeRecorder::CALL_INSTANCE_ACCESSOR_NAME_ATTRIBUTE_NAME = "instanceAccessorName";
+const char *CYIBitmovinBridgeRecorder::CALL_FUNCTION_NAME_ATTRIBUTE_NAME = "functionName";
+const char *CYIBitmovinBridgeRecorder::CALL_ARGUMENTS_ATTRIBUTE_NAME = "arguments";
+const char *CYIBitmovinBridgeRecorder::RESPONSE_RESULT_ATTRIBUTE_NAME = "result";
+const char *CYIBitmovinBridgeRecorder::RESPONSE_ERROR_ATTRIBUTE_NAME = "error";
+const char *CYIBitmovinBridgeRecorder::RESPONSE_TIMED_OUT_ATTRIBUTE_NAME = "timedOut";
+const uint64_t CYIBitmovinBridgeRecorder::DEFAULT_MAXIMUM_CAPTURE_SIZE_BYTES = 32 * 1024 * 1024;
+
+static size_t WriteVarint(std::ofstream &stream, uint64_t value)
+{
+    char buffer[10];
+    size_t size = 0;
+
+    do
+    {
+        uint8_t byte = static_cast<uint8_t>(value & 0x7F);
+        value >>= 7;
+        buffer[size++] = static_cast<char>(value ? byte | 0x80 : byte);
+    } while (value);
+
+    stream.write(buffer, static_cast<std::streamsize>(size));
+
+    return size;
+}
+
+static bool ReadVarint(std::ifstream &stream, uint64_t &value)
+{
+    value = 0;
+
+    for (uint32_t shift = 0; shift < 64; shift += 7)
+    {
+        char byte = 0;
+
+        if (!stream.get(byte))
+        {
+            return false;
+        }
+
+        value |= static_cast<uint64_t>(static_cast<uint8_t>(byte) & 0x7F) << shift;
+
+        if (!(static_cast<uint8_t>(byte) & 0x80))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+struct CYIBitmovinBridgeRecorder::CaptureFile
+{
+    void Write(RecordType type, uint64_t callId, const CYIString &payload)
+    {
+        if (!stream.is_open())
+        {
+            return;
+        }
+
+        uint64_t timestampUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count());
+        size_t payloadSize = std::strlen(payload.GetData());
+
+        // a record is at most 31 bytes longer than its payload, the type and three varints of up to 10 bytes each
+        if (sizeBytes + payloadSize + 31 > maximumSizeBytes)
+        {
+            YI_LOGW(LOG_TAG, "Stopped bridge recording after %llu records, the capture file reached its maximum size of %llu bytes.", (long long unsigned)recordCount, (long long unsigned)maximumSizeBytes);
+
+            stream.close();
+            return;
+        }
+
+        // timestamps are stored as deltas so that most records only need one or two bytes for them
+        stream.put(static_cast<char>(type));
+        size_t recordSize = 1;
+        recordSize += WriteVarint(stream, timestampUs - lastTimestampUs);
+        recordSize += WriteVarint(stream, callId);
+        recordSize += WriteVarint(stream, payloadSize);
+        stream.write(payload.GetData(), static_cast<std::streamsize>(payloadSize));
+        recordSize += payloadSize;
+
+        sizeBytes += recordSize;
+        lastTimestampUs = timestampUs;
+        recordCount++;
+    }
+
+    void WriteResponse(uint64_t callId, const Response &response)
+    {
+        if (!stream.is_open())
+        {
+            return;
+        }
+
+        CYIString payload;
+
+        if (response.hasError)
+        {
+            yi::rapidjson::Value errorValue(yi::rapidjson::StringRef(response.errorMessage.GetData()));
+            payload = CYIString("{\"") + RESPONSE_ERROR_ATTRIBUTE_NAME + "\":" + CYIRapidJSONUtility::CreateStringFromValue(errorValue) + "}";
+        }
+        else
+        {
+            payload = CYIString("{\"") + RESPONSE_RESULT_ATTRIBUTE_NAME + "\":" + (response.pResult ? CYIRapidJSONUtility::CreateStringFromValue(*response.pResult) : CYIString("null")) + "}";
+        }
+
+        Write(RecordType::Response, callId, payload);
+    }
+
+    std::ofstream stream;
+    std::chrono::steady_clock::time_point startTime;
+    uint64_t lastTimestampUs = 0;
+    uint64_t recordCount = 0;
+    uint64_t sizeBytes = 0;
+    uint64_t maximumSizeBytes = 0;
+    uint64_t nextCallId = 1;
+};
+
+CYIBitmovinBridgeRecorder::CYIBitmovinBridgeRecorder(CYIBitmovinBridgeTransport *pTransport)
+    : m_pTransport(pTransport)
+    , m_pCaptureFile(new CaptureFile())
+{
+}
+
+CYIBitmovinBridgeRecorder::~CYIBitmovinBridgeRecorder()
+{
+    Close();
+}
+
+bool CYIBitmovinBridgeRecorder::Open(const CYIString &filePath, uint64_t maximumCaptureSizeBytes)
+{
+    Close();
+
+    m_pCaptureFile->stream.open(filePath.GetData(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!m_pCaptureFile->stream.is_open())
+    {
+        YI_LOGW(LOG_TAG, "Failed to open bridge capture file: %s", filePath.GetData());
+        return false;
+    }
+
+    m_pCaptureFile->stream.write(CAPTURE_MAGIC, CAPTURE_MAGIC_SIZE);
+    m_pCaptureFile->startTime = std::chrono::steady_clock::now();
+    m_pCaptureFile->lastTimestampUs = 0;
+    m_pCaptureFile->recordCount = 0;
+    m_pCaptureFile->sizeBytes = CAPTURE_MAGIC_SIZE;
+    m_pCaptureFile->maximumSizeBytes = maximumCaptureSizeBytes;
+
+    return true;
+}
+
+void CYIBitmovinBridgeRecorder::Close()
+{
+    if (m_pCaptureFile->stream.is_open())
+    {
+        m_pCaptureFile->stream.close();
+    }
+}
+
+bool CYIBitmovinBridgeRecorder::IsOpen() const
+{
+    return m_pCaptureFile->stream.is_open();
+}
+
+uint64_t CYIBitmovinBridgeRecorder::GetRecordCount() const
+{
+    return m_pCaptureFile->recordCount;
+}
+
+CYIBitmovinBridgeTransport *CYIBitmovinBridgeRecorder::GetTransport() const
+{
+    return m_pTransport;
+}
+
+void CYIBitmovinBridgeRecorder::SetRecordedClassName(const CYIString &className)
+{
+    m_recordedClassName = className;
+}
+
+bool CYIBitmovinBridgeRecorder::ReadCapture(const CYIString &filePath, std::vector<Record> &records)
+{
+    std::ifstream stream(filePath.GetData(), std::ios::in | std::ios::binary);
+
+    if (!stream.is_open())
+    {
+        return false;
+    }
+
+    char magic[CAPTURE_MAGIC_SIZE] = {};
+
+    if (!stream.read(magic, CAPTURE_MAGIC_SIZE) || !std::equal(magic, magic + CAPTURE_MAGIC_SIZE, CAPTURE_MAGIC))
+    {
+        YI_LOGW(LOG_TAG, "%s is not a bridge capture file.", filePath.GetData());
+        return false;
+    }
+
+    uint64_t timestampUs = 0;
+    char type = 0;
+
+    while (stream.get(type))
+    {
+        Record record;
+        uint64_t timestampDeltaUs = 0;
+        uint64_t payloadSize = 0;
+
+        if (static_cast<uint8_t>(type) > static_cast<uint8_t>(RecordType::Event) || !ReadVarint(stream, timestampDeltaUs) || !ReadVarint(stream, record.callId) || !ReadVarint(stream, payloadSize) || payloadSize > MAX_PAYLOAD_SIZE)
+        {
+            // a capture cut short by a crash is still usable up to its last complete record
+            YI_LOGW(LOG_TAG, "Bridge capture file %s is truncated or corrupt after %zu records.", filePath.GetData(), records.size());
+            break;
+        }
+
+        std::string payload(static_cast<size_t>(payloadSize), '\0');
+
+        if (!stream.read(&payload[0], static_cast<std::streamsize>(payloadSize)))
+        {
+            YI_LOGW(LOG_TAG, "Bridge capture file %s is truncated or corrupt after %zu records.", filePath.GetData(), records.size());
+            break;
+        }
+
+        timestampUs += timestampDeltaUs;
+
+        record.type = static_cast<RecordType>(type);
+        record.timestampUs = timestampUs;
+        record.payload = CYIString(payload.c_str());
+
+        records.push_back(std::move(record));
+    }
+
+    return true;
+}
+
+bool CYIBitmovinBridgeRecorder::IsConnected() const
+{
+    return m_pTransport->IsConnected();
+}
+
+bool CYIBitmovinBridgeRecorder::Call(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, CYISignalHandler *pResponseHandlerOwner, ResponseHandler &&responseHandler)
+{
+    if (!IsRecorded(pClassName))
+    {
+        return m_pTransport->Call(target, pClassName, pInstanceAccessorName, pFunctionName, std::move(command), std::move(arguments), pResponseHandlerOwner, std::move(responseHandler));
+    }
+
+    uint64_t callId = RecordCall(target, pClassName, pInstanceAccessorName, pFunctionName, arguments);
+
+    if (!pResponseHandlerOwner || !responseHandler)
+    {
+        return m_pTransport->Call(target, pClassName, pInstanceAccessorName, pFunctionName, std::move(command), std::move(arguments));
+    }
+
+    std::shared_ptr<CaptureFile> pCaptureFile(m_pCaptureFile);
+
+    return m_pTransport->Call(target, pClassName, pInstanceAccessorName, pFunctionName, std::move(command), std::move(arguments), pResponseHandlerOwner, [pCaptureFile, callId, responseHandler](const Response &response) {
+        pCaptureFile->WriteResponse(callId, response);
+
+        responseHandler(response);
+    });
+}
+
+CYIBitmovinBridgeTransport::CallStatus CYIBitmovinBridgeRecorder::CallAndWait(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, uint64_t timeoutMs, const ResponseHandler &responseHandler)
+{
+    if (!IsRecorded(pClassName))
+    {
+        return m_pTransport->CallAndWait(target, pClassName, pInstanceAccessorName, pFunctionName, std::move(command), std::move(arguments), timeoutMs, responseHandler);
+    }
+
+    uint64_t callId = RecordCall(target, pClassName, pInstanceAccessorName, pFunctionName, arguments);
+    CaptureFile *pCaptureFile = m_pCaptureFile.get();
+
+    CallStatus callStatus = m_pTransport->CallAndWait(target, pClassName, pInstanceAccessorName, pFunctionName, std::move(command), std::move(arguments), timeoutMs, [pCaptureFile, callId, &responseHandler](const Response &response) {
+        pCaptureFile->WriteResponse(callId, response);
+
+        if (responseHandler)
+        {
+            responseHandler(response);
+        }
+    });
+
+    if (callStatus == CallStatus::TimedOut)
+    {
+        m_pCaptureFile->Write(RecordType::Response, callId, CYIString("{\"") + RESPONSE_TIMED_OUT_ATTRIBUTE_NAME + "\":true}");
+    }
+
+    return callStatus;
+}
+
+uint64_t CYIBitmovinBridgeRecorder::RegisterEventHandler(const CYIString &contextName, EventHandler &&eventHandler)
+{
+    std::shared_ptr<CaptureFile> pCaptureFile(m_pCaptureFile);
+    EventHandler wrappedEventHandler(std::move(eventHandler));
+
+    // note: the wrapped transport's handler id is returned as is, so the handler can be unregistered once recording has stopped
+    return m_pTransport->RegisterEventHandler(contextName, [pCaptureFile, wrappedEventHandler](const yi::rapidjson::Value &eventValue) {
+        if (pCaptureFile->stream.is_open())
+        {
+            pCaptureFile->Write(RecordType::Event, 0, CYIRapidJSONUtility::CreateStringFromValue(eventValue));
+        }
+
+        wrappedEventHandler(eventValue);
+    });
+}
+
+void CYIBitmovinBridgeRecorder::UnregisterEventHandler(uint64_t eventHandlerId)
+{
+    m_pTransport->UnregisterEventHandler(eventHandlerId);
+}
+
+uint64_t CYIBitmovinBridgeRecorder::RecordCall(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, const yi::rapidjson::Value &arguments)
+{
+    uint64_t callId = m_pCaptureFile->nextCallId++;
+
+    if (m_pCaptureFile->stream.is_open())
+    {
+        // class, instance accessor and function names are plain identifiers, so only the arguments need to go through the JSON writer
+        CYIString payload = CYIString("{\"") + CALL_TARGET_ATTRIBUTE_NAME + "\":" + (target == Target::Instance ? "1" : "0") + ",\"" + CALL_CLASS_NAME_ATTRIBUTE_NAME + "\":\"" + pClassName + "\",\"" + CALL_INSTANCE_ACCESSOR_NAME_ATTRIBUTE_NAME + "\":\"" + pInstanceAccessorName + "\",\"" + CALL_FUNCTION_NAME_ATTRIBUTE_NAME + "\":\"" + pFunctionName + "\",\"" + CALL_ARGUMENTS_ATTRIBUTE_NAME + "\":" + CYIRapidJSONUtility::CreateStringFromValue(arguments) + "}";
+
+        m_pCaptureFile->Write(RecordType::Call, callId, payload);
+    }
+
+    return callId;
+}
+
+bool CYIBitmovinBridgeRecorder::IsRecorded(const char *pClassName) const
+{
+    return m_recordedClassName.IsEmpty() || std::strcmp(m_recordedClassName.GetData(), pClassName) == 0;
+}
@@ -0,0 +1,74 @@
+#ifndef _YI_BITMOVIN_BRIDGE_RECORDER_H_
+#define _YI_BITMOVIN_BRIDGE_RECORDER_H_
+
+#include "YiBitmovinBridgeTransport.h"
+
+#include <memory>
+#include <vector>
+
+// note: wraps another transport and appends every call, response and event passing through it to a capture file, until the capture file
+// reaches its maximum size
+// note: a capture is a 4 byte magic followed by records of [type:u8][timestamp delta us:varint][call id:varint][payload length:varint][payload:JSON]
+class CYIBitmovinBridgeRecorder : public CYIBitmovinBridgeTransport
+{
+public:
+    enum class RecordType : uint8_t
+    {
+        Call = 0,
+        Response = 1,
+        Event = 2
+    };
+
+    struct Record
+    {
+        RecordType type = RecordType::Event;
+        uint64_t timestampUs = 0;
+        uint64_t callId = 0;
+        CYIString payload;
+    };
+
+    static const char *CALL_TARGET_ATTRIBUTE_NAME;
+    static const char *CALL_CLASS_NAME_ATTRIBUTE_NAME;
+    static const char *CALL_INSTANCE_ACCESSOR_NAME_ATTRIBUTE_NAME;
+    static const char *CALL_FUNCTION_NAME_ATTRIBUTE_NAME;
+    static const char *CALL_ARGUMENTS_ATTRIBUTE_NAME;
+    static const char *RESPONSE_RESULT_ATTRIBUTE_NAME;
+    static const char *RESPONSE_ERROR_ATTRIBUTE_NAME;
+    static const char *RESPONSE_TIMED_OUT_ATTRIBUTE_NAME;
+
+    CYIBitmovinBridgeRecorder(CYIBitmovinBridgeTransport *pTransport);
+    virtual ~CYIBitmovinBridgeRecorder();
+
+    static const uint64_t DEFAULT_MAXIMUM_CAPTURE_SIZE_BYTES;
+
+    bool Open(const CYIString &filePath, uint64_t maximumCaptureSizeBytes = DEFAULT_MAXIMUM_CAPTURE_SIZE_BYTES);
+    void Close();
+    bool IsOpen() const;
+    uint64_t GetRecordCount() const;
+    CYIBitmovinBridgeTransport *GetTransport() const;
+
+    // note: when set, calls to other classes and their responses are passed through without being recorded
+    void SetRecordedClassName(const CYIString &className);
+
+    static bool ReadCapture(const CYIString &filePath, std::vector<Record> &records);
+
+    virtual bool IsConnected() const override;
+    virtual bool Call(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, CYISignalHandler *pResponseHandlerOwner = nullptr, ResponseHandler &&responseHandler = ResponseHandler()) override;
+    virtual CallStatus CallAndWait(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, uint64_t timeoutMs, const ResponseHandler &responseHandler) override;
+    virtual uint64_t RegisterEventHandler(const CYIString &contextName, EventHandler &&eventHandler) override;
+    virtual void UnregisterEventHandler(uint64_t eventHandlerId) override;
+
+private:
+    struct CaptureFile;
+
+    uint64_t RecordCall(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, const yi::rapidjson::Value &arguments);
+    bool IsRecorded(const char *pClassName) const;
+
+    CYIBitmovinBridgeTransport *m_pTransport;
+    CYIString m_recordedClassName;
+
+    // note: shared with the response and event handlers handed to the wrapped transport, which may outlive the recorder
+    std::shared_ptr<CaptureFile> m_pCaptureFile;
+};
+
+#endif // _YI_BITMOVIN_BRIDGE_RECORDER_H_
@@ -0,0 +1,371 @@
+#include "YiBitmovinBridgeReplayer.h"
+
+#include <logging/YiLogger.h>
+#include <platform/YiWebMessagingBridge.h>
+
+#define LOG_TAG "CYIBitmovinBridgeReplayer"
+
+static const char *NULL_RESPONSE_PAYLOAD = "{\"result\":null}";
+
+static bool ParsePayload(const CYIString &payload, yi::rapidjson::Document &document)
+{
+    document.Parse(payload.GetData());
+
+    return !document.HasParseError() && document.IsObject();
+}
+
+static CYIString GetStringMember(const yi::rapidjson::Value &value, const char *pName)
+{
+    yi::rapidjson::Value::ConstMemberIterator memberIterator = value.FindMember(pName);
+
+    return memberIterator != value.MemberEnd() && memberIterator->value.IsString() ? CYIString(memberIterator->value.GetString()) : CYIString();
+}
+
+CYIBitmovinBridgeReplayer::CYIBitmovinBridgeReplayer()
+    : m_nextEventHandlerId(1)
+    , m_captureDurationUs(0)
+    , m_nextEventIndex(0)
+    , m_replaying(false)
+    , m_mode(Mode::AsFastAsPossible)
+{
+    m_tickTimer.TimedOut.Connect(*this, &CYIBitmovinBridgeReplayer::OnTickTimerTimedOut);
+}
+
+CYIBitmovinBridgeReplayer::~CYIBitmovinBridgeReplayer()
+{
+    m_tickTimer.Stop();
+
+    if (CYIBitmovinBridgeTransport::GetInstance() == this)
+    {
+        CYIBitmovinBridgeTransport::SetInstance(nullptr);
+    }
+}
+
+bool CYIBitmovinBridgeReplayer::Load(const CYIString &filePath)
+{
+    std::vector<CYIBitmovinBridgeRecorder::Record> records;
+
+    if (m_replaying || !CYIBitmovinBridgeRecorder::ReadCapture(filePath, records))
+    {
+        return false;
+    }
+
+    m_events.clear();
+    m_responses.clear();
+    m_captureDurationUs = records.empty() ? 0 : records.back().timestampUs;
+
+    std::map<uint64_t, CYIString> callResponseKeys;
+    size_t responseCount = 0;
+
+    for (CYIBitmovinBridgeRecorder::Record &record : records)
+    {
+        if (record.type == CYIBitmovinBridgeRecorder::RecordType::Event)
+        {
+            m_events.push_back(std::move(record));
+        }
+        else if (record.type == CYIBitmovinBridgeRecorder::RecordType::Call)
+        {
+            yi::rapidjson::Document callDocument;
+
+            if (ParsePayload(record.payload, callDocument) && callDocument.HasMember(CYIBitmovinBridgeRecorder::CALL_FUNCTION_NAME_ATTRIBUTE_NAME) && callDocument[CYIBitmovinBridgeRecorder::CALL_FUNCTION_NAME_ATTRIBUTE_NAME].IsString())
+            {
+                yi::rapidjson::Value::ConstMemberIterator targetIterator = callDocument.FindMember(CYIBitmovinBridgeRecorder::CALL_TARGET_ATTRIBUTE_NAME);
+                Target target = targetIterator != callDocument.MemberEnd() && targetIterator->value.IsInt() && targetIterator->value.GetInt() == 1 ? Target::Instance : Target::Static;
+
+                callResponseKeys[record.callId] = CreateResponseKey(target, GetStringMember(callDocument, CYIBitmovinBridgeRecorder::CALL_CLASS_NAME_ATTRIBUTE_NAME), GetStringMember(callDocument, CYIBitmovinBridgeRecorder::CALL_INSTANCE_ACCESSOR_NAME_ATTRIBUTE_NAME), callDocument[CYIBitmovinBridgeRecorder::CALL_FUNCTION_NAME_ATTRIBUTE_NAME].GetString());
+            }
+        }
+        else
+        {
+            // responses are queued per call target in the order they arrived, so they are handed out in the same order on replay
+            std::map<uint64_t, CYIString>::iterator callResponseKeyIterator = callResponseKeys.find(record.callId);
+
+            if (callResponseKeyIterator != callResponseKeys.end())
+            {
+                m_responses[callResponseKeyIterator->second].push_back(std::move(record.payload));
+                callResponseKeys.erase(callResponseKeyIterator);
+                responseCount++;
+            }
+        }
+    }
+
+    YI_LOGI(LOG_TAG, "Loaded %zu events and %zu responses from %s.", m_events.size(), responseCount, filePath.GetData());
+
+    return true;
+}
+
+bool CYIBitmovinBridgeReplayer::Start(Mode mode)
+{
+    if (m_replaying || m_events.empty())
+    {
+        return false;
+    }
+
+    m_mode = mode;
+    m_replaying = true;
+    m_nextEventIndex = 0;
+    m_replayStartTime = std::chrono::steady_clock::now();
+
+    ReplayDueEvents();
+    ScheduleTick();
+
+    return true;
+}
+
+void CYIBitmovinBridgeReplayer::Stop()
+{
+    m_replaying = false;
+
+    ScheduleTick();
+}
+
+bool CYIBitmovinBridgeReplayer::IsReplaying() const
+{
+    return m_replaying;
+}
+
+size_t CYIBitmovinBridgeReplayer::GetEventCount() const
+{
+    return m_events.size();
+}
+
+size_t CYIBitmovinBridgeReplayer::GetReplayedEventCount() const
+{
+    return m_nextEventIndex;
+}
+
+std::chrono::microseconds CYIBitmovinBridgeReplayer::GetCaptureDuration() const
+{
+    return std::chrono::microseconds(m_captureDurationUs);
+}
+
+bool CYIBitmovinBridgeReplayer::IsConnected() const
+{
+    return true;
+}
+
+bool CYIBitmovinBridgeReplayer::Call(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, CYISignalHandler *pResponseHandlerOwner, ResponseHandler &&responseHandler)
+{
+    YI_UNUSED(command);
+    YI_UNUSED(arguments);
+
+    std::shared_ptr<yi::rapidjson::Document> pResponseDocument(new yi::rapidjson::Document());
+    TakeRecordedResponse(target, pClassName, pInstanceAccessorName, pFunctionName, *pResponseDocument);
+
+    if (!pResponseHandlerOwner || !responseHandler)
+    {
+        return true;
+    }
+
+    // responses are delivered from the next tick, as they would be by the web messaging bridge
+    std::shared_ptr<CYISignal<>> pCompleted(new CYISignal<>());
+    pCompleted->Connect(*pResponseHandlerOwner, std::function<void()>([responseHandler, pResponseDocument]() {
+        responseHandler(CreateResponse(*pResponseDocument));
+    }));
+
+    m_pendingResponses.push_back(pCompleted);
+
+    ScheduleTick();
+
+    return true;
+}
+
+CYIBitmovinBridgeTransport::CallStatus CYIBitmovinBridgeReplayer::CallAndWait(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, uint64_t timeoutMs, const ResponseHandler &responseHandler)
+{
+    YI_UNUSED(command);
+    YI_UNUSED(arguments);
+    YI_UNUSED(timeoutMs);
+
+    yi::rapidjson::Document responseDocument;
+    TakeRecordedResponse(target, pClassName, pInstanceAccessorName, pFunctionName, responseDocument);
+
+    // a recorded timeout is reproduced without actually waiting for it
+    if (responseDocument.HasMember(CYIBitmovinBridgeRecorder::RESPONSE_TIMED_OUT_ATTRIBUTE_NAME))
+    {
+        return CallStatus::TimedOut;
+    }
+
+    if (responseHandler)
+    {
+        responseHandler(CreateResponse(responseDocument));
+    }
+
+    return CallStatus::Received;
+}
+
+uint64_t CYIBitmovinBridgeReplayer::RegisterEventHandler(const CYIString &contextName, EventHandler &&eventHandler)
+{
+    uint64_t eventHandlerId = m_nextEventHandlerId++;
+
+    RegisteredEventHandler &registeredEventHandler = m_eventHandlers[eventHandlerId];
+    registeredEventHandler.contextName = contextName;
+    registeredEventHandler.eventHandler = std::move(eventHandler);
+
+    return eventHandlerId;
+}
+
+void CYIBitmovinBridgeReplayer::UnregisterEventHandler(uint64_t eventHandlerId)
+{
+    m_eventHandlers.erase(eventHandlerId);
+}
+
+bool CYIBitmovinBridgeReplayer::TakeRecordedResponse(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &responseDocument)
+{
+    CYIString responseKey(CreateResponseKey(target, pClassName, pInstanceAccessorName, pFunctionName));
+    std::map<CYIString, std::deque<CYIString>>::iterator responsesIterator = m_responses.find(responseKey);
+
+    // captures recorded before class names were recorded only know the function
+    if (responsesIterator == m_responses.end())
+    {
+        return TakeRecordedResponse(CreateResponseKey(target, CYIString(), CYIString(), pFunctionName), responseDocument);
+    }
+
+    return TakeRecordedResponse(responseKey, responseDocument);
+}
+
+bool CYIBitmovinBridgeReplayer::TakeRecordedResponse(const CYIString &responseKey, yi::rapidjson::Document &responseDocument)
+{
+    std::map<CYIString, std::deque<CYIString>>::iterator responsesIterator = m_responses.find(responseKey);
+
+    if (responsesIterator != m_responses.end() && !responsesIterator->second.empty())
+    {
+        CYIString payload(std::move(responsesIterator->second.front()));
+        responsesIterator->second.pop_front();
+
+        if (ParsePayload(payload, responseDocument))
+        {
+            return true;
+        }
+
+        YI_LOGW(LOG_TAG, "Discarding invalid recorded %s response: %s", responseKey.GetData(), payload.GetData());
+    }
+
+    ParsePayload(NULL_RESPONSE_PAYLOAD, responseDocument);
+
+    return false;
+}
+
+CYIString CYIBitmovinBridgeReplayer::CreateResponseKey(Target target, const CYIString &className, const CYIString &instanceAccessorName, const CYIString &functionName)
+{
+    // static calls do not go through an instance accessor, so it is left out of their key
+    return className + "." + (target == Target::Instance ? instanceAccessorName : CYIString()) + "." + functionName;
+}
+
+CYIBitmovinBridgeTransport::Response CYIBitmovinBridgeReplayer::CreateResponse(const yi::rapidjson::Document &responseDocument)
+{
+    Response response;
+
+    yi::rapidjson::Value::ConstMemberIterator errorIterator = responseDocument.FindMember(CYIBitmovinBridgeRecorder::RESPONSE_ERROR_ATTRIBUTE_NAME);
+
+    if (errorIterator != responseDocument.MemberEnd())
+    {
+        response.hasError = true;
+        response.errorMessage = errorIterator->value.IsString() ? CYIString(errorIterator->value.GetString()) : CYIRapidJSONUtility::CreateStringFromValue(errorIterator->value);
+        return response;
+    }
+
+    yi::rapidjson::Value::ConstMemberIterator resultIterator = responseDocument.FindMember(CYIBitmovinBridgeRecorder::RESPONSE_RESULT_ATTRIBUTE_NAME);
+
+    if (resultIterator != responseDocument.MemberEnd())
+    {
+        response.pResult = &resultIterator->value;
+    }
+
+    return response;
+}
+
+void CYIBitmovinBridgeReplayer::DispatchEvent(const CYIString &payload)
+{
+    yi::rapidjson::Document eventDocument;
+
+    if (!ParsePayload(payload, eventDocument) || !eventDocument.HasMember(CYIWebMessagingBridge::EVENT_CONTEXT_ATTRIBUTE_NAME) || !eventDocument[CYIWebMessagingBridge::EVENT_CONTEXT_ATTRIBUTE_NAME].IsString())
+    {
+        YI_LOGW(LOG_TAG, "Skipping invalid recorded event: %s", payload.GetData());
+        return;
+    }
+
+    CYIString contextName(eventDocument[CYIWebMessagingBridge::EVENT_CONTEXT_ATTRIBUTE_NAME].GetString());
+    std::vector<uint64_t> eventHandlerIds;
+
+    for (const std::pair<const uint64_t, RegisteredEventHandler> &eventHandlerEntry : m_eventHandlers)
+    {
+        if (eventHandlerEntry.second.contextName == contextName)
+        {
+            eventHandlerIds.push_back(eventHandlerEntry.first);
+        }
+    }
+
+    // handlers may unregister themselves or each other while the event is being dispatched
+    for (uint64_t eventHandlerId : eventHandlerIds)
+    {
+        std::map<uint64_t, RegisteredEventHandler>::iterator eventHandlerIterator = m_eventHandlers.find(eventHandlerId);
+
+        if (eventHandlerIterator != m_eventHandlers.end())
+        {
+            EventHandler eventHandler(eventHandlerIterator->second.eventHandler);
+
+            eventHandler(eventDocument);
+        }
+    }
+}
+
+void CYIBitmovinBridgeReplayer::ReplayDueEvents()
+{
+    uint64_t firstEventTimestampUs = m_events.front().timestampUs;
+    uint64_t elapsedUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_replayStartTime).count());
+
+    // in real time mode the gaps between events are reproduced relative to the first event, otherwise everything is due immediately
+    while (m_replaying && m_nextEventIndex < m_events.size() && (m_mode == Mode::AsFastAsPossible || m_events[m_nextEventIndex].timestampUs - firstEventTimestampUs <= elapsedUs))
+    {
+        const CYIString &payload = m_events[m_nextEventIndex].payload;
+        m_nextEventIndex++;
+
+        DispatchEvent(payload);
+    }
+
+    if (m_replaying && m_nextEventIndex == m_events.size())
+    {
+        m_replaying = false;
+
+        YI_LOGI(LOG_TAG, "Replayed %zu events in %lldms.", m_events.size(), (long long)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_replayStartTime).count());
+
+        ReplayCompleted.Emit();
+    }
+}
+
+void CYIBitmovinBridgeReplayer::ScheduleTick()
+{
+    if (!m_pendingResponses.empty())
+    {
+        m_tickTimer.Start(0);
+    }
+    else if (m_replaying && m_mode == Mode::RealTime)
+    {
+        uint64_t nextEventOffsetUs = m_events[m_nextEventIndex].timestampUs - m_events.front().timestampUs;
+        uint64_t elapsedUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_replayStartTime).count());
+
+        m_tickTimer.Start(nextEventOffsetUs > elapsedUs ? (nextEventOffsetUs - elapsedUs) / 1000 + 1 : 0);
+    }
+    else
+    {
+        m_tickTimer.Stop();
+    }
+}
+
+void CYIBitmovinBridgeReplayer::OnTickTimerTimedOut()
+{
+    std::vector<std::shared_ptr<CYISignal<>>> pendingResponses;
+    pendingResponses.swap(m_pendingResponses);
+
+    for (const std::shared_ptr<CYISignal<>> &pCompleted : pendingResponses)
+    {
+        pCompleted->Emit();
+    }
+
+    if (m_replaying)
+    {
+        ReplayDueEvents();
+    }
+
+    ScheduleTick();
+}
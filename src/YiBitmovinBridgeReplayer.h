@@ -0,0 +1,75 @@
+#ifndef _YI_BITMOVIN_BRIDGE_REPLAYER_H_
+#define _YI_BITMOVIN_BRIDGE_REPLAYER_H_
+
+#include "YiBitmovinBridgeRecorder.h"
+
+#include <signal/YiSignal.h>
+#include <signal/YiSignalHandler.h>
+#include <utility/YiTimer.h>
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <vector>
+
+// note: replays the events of a capture written by CYIBitmovinBridgeRecorder to the registered event handlers, calls are answered
+// with the responses recorded for the same class, instance accessor and function in capture order, or with a null result once those
+// run out. Captures recorded without class names are matched by function only.
+class CYIBitmovinBridgeReplayer : public CYIBitmovinBridgeTransport, public CYISignalHandler
+{
+public:
+    enum class Mode
+    {
+        AsFastAsPossible,
+        RealTime
+    };
+
+    CYIBitmovinBridgeReplayer();
+    virtual ~CYIBitmovinBridgeReplayer();
+
+    bool Load(const CYIString &filePath);
+    bool Start(Mode mode);
+    void Stop();
+    bool IsReplaying() const;
+    size_t GetEventCount() const;
+    size_t GetReplayedEventCount() const;
+    std::chrono::microseconds GetCaptureDuration() const;
+
+    virtual bool IsConnected() const override;
+    virtual bool Call(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, CYISignalHandler *pResponseHandlerOwner = nullptr, ResponseHandler &&responseHandler = ResponseHandler()) override;
+    virtual CallStatus CallAndWait(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, uint64_t timeoutMs, const ResponseHandler &responseHandler) override;
+    virtual uint64_t RegisterEventHandler(const CYIString &contextName, EventHandler &&eventHandler) override;
+    virtual void UnregisterEventHandler(uint64_t eventHandlerId) override;
+
+    CYISignal<> ReplayCompleted;
+
+private:
+    struct RegisteredEventHandler
+    {
+        CYIString contextName;
+        EventHandler eventHandler;
+    };
+
+    bool TakeRecordedResponse(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &responseDocument);
+    bool TakeRecordedResponse(const CYIString &responseKey, yi::rapidjson::Document &responseDocument);
+    static CYIString CreateResponseKey(Target target, const CYIString &className, const CYIString &instanceAccessorName, const CYIString &functionName);
+    static Response CreateResponse(const yi::rapidjson::Document &responseDocument);
+    void DispatchEvent(const CYIString &payload);
+    void ReplayDueEvents();
+    void ScheduleTick();
+    void OnTickTimerTimedOut();
+
+    std::vector<CYIBitmovinBridgeRecorder::Record> m_events;
+    std::map<CYIString, std::deque<CYIString>> m_responses;
+    std::map<uint64_t, RegisteredEventHandler> m_eventHandlers;
+    std::vector<std::shared_ptr<CYISignal<>>> m_pendingResponses;
+    uint64_t m_nextEventHandlerId;
+    uint64_t m_captureDurationUs;
+    size_t m_nextEventIndex;
+    bool m_replaying;
+    Mode m_mode;
+    std::chrono::steady_clock::time_point m_replayStartTime;
+    CYITimer m_tickTimer;
+};
+
+#endif // _YI_BITMOVIN_BRIDGE_REPLAYER_H_
@@ -0,0 +1,317 @@
+#include "YiBitmovinBridgeScheduler.h"
+
+#include "YiBitmovinCommandPipeline.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#define LOG_TAG "CYIBitmovinBridgeScheduler"
+
+static const char *DROPPED_LOG_MESSAGES_LEVEL = "warning";
+
+CYIBitmovinBridgeScheduler *CYIBitmovinBridgeScheduler::s_pInstance = nullptr;
+
+CYIBitmovinBridgeScheduler &CYIBitmovinBridgeScheduler::GetInstance()
+{
+    if (!s_pInstance)
+    {
+        s_pInstance = new CYIBitmovinBridgeScheduler();
+    }
+
+    return *s_pInstance;
+}
+
+void CYIBitmovinBridgeScheduler::Shutdown()
+{
+    delete s_pInstance;
+    s_pInstance = nullptr;
+}
+
+CYIBitmovinBridgeScheduler::CYIBitmovinBridgeScheduler()
+    : m_telemetryTokens(0.0f)
+    , m_lastTelemetryRefillTime(std::chrono::steady_clock::now())
+    , m_controlMessagesAwaitingResponseCount(0)
+    , m_logMessages(m_configuration.maximumQueuedLogMessageCount, m_configuration.maximumLogMessageLength)
+    , m_failedLogMessageCount(0)
+    , m_reportedDroppedLogMessageCount(0)
+    , m_logMessagesHeld(false)
+    , m_replayHeldLogMessages(false)
+{
+    m_telemetryTokens = static_cast<float>(m_configuration.telemetryBurst);
+
+    m_tickTimer.TimedOut.Connect(*this, &CYIBitmovinBridgeScheduler::OnTickTimerTimedOut);
+    m_tickTimer.Start(static_cast<uint64_t>(m_configuration.tickInterval.count()));
+}
+
+CYIBitmovinBridgeScheduler::~CYIBitmovinBridgeScheduler()
+{
+    m_tickTimer.Stop();
+
+    // released pipelines may still reach the scheduler while they are destroyed, so they go first
+    m_releasedCommandPipelines.clear();
+}
+
+void CYIBitmovinBridgeScheduler::SetConfiguration(const Configuration &configuration)
+{
+    m_configuration = configuration;
+    m_telemetryTokens = std::min(m_telemetryTokens, static_cast<float>(m_configuration.telemetryBurst));
+}
+
+const CYIBitmovinBridgeScheduler::Configuration &CYIBitmovinBridgeScheduler::GetConfiguration() const
+{
+    return m_configuration;
+}
+
+bool CYIBitmovinBridgeScheduler::Send(MessageClass messageClass, Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, CYISignalHandler *pResponseHandlerOwner, CYIBitmovinBridgeTransport::ResponseHandler &&responseHandler)
+{
+    if (messageClass == MessageClass::Telemetry)
+    {
+        YI_ASSERT(!responseHandler, LOG_TAG, "Telemetry messages cannot watch for a response.");
+
+        // a newer telemetry message replaces the queued one in place, so it keeps its position in the queue rather than being starved by other functions
+        // note: each player instance has its own instance accessor, so telemetry from different players is never coalesced together
+        std::vector<TelemetryMessage>::iterator telemetryMessageIterator = std::find_if(m_telemetryMessages.begin(), m_telemetryMessages.end(), [target, pClassName, pInstanceAccessorName, pFunctionName](const TelemetryMessage &telemetryMessage) {
+            return telemetryMessage.target == target && std::strcmp(telemetryMessage.functionName.GetData(), pFunctionName) == 0 && std::strcmp(telemetryMessage.className.GetData(), pClassName) == 0 && (target == Target::Static || std::strcmp(telemetryMessage.instanceAccessorName.GetData(), pInstanceAccessorName) == 0);
+        });
+
+        if (telemetryMessageIterator == m_telemetryMessages.end())
+        {
+            TelemetryMessage telemetryMessage;
+            telemetryMessage.target = target;
+            telemetryMessage.className = pClassName;
+            telemetryMessage.instanceAccessorName = pInstanceAccessorName;
+            telemetryMessage.functionName = pFunctionName;
+
+            m_telemetryMessages.push_back(std::move(telemetryMessage));
+            telemetryMessageIterator = m_telemetryMessages.end() - 1;
+        }
+        else
+        {
+            m_statistics.coalescedTelemetryMessageCount++;
+        }
+
+        // the message may have been built in an arena which is reset before the message is sent, so it is copied into its own document
+        telemetryMessageIterator->command = yi::rapidjson::Document(yi::rapidjson::kObjectType);
+        telemetryMessageIterator->arguments = yi::rapidjson::Value(arguments, telemetryMessageIterator->command.GetAllocator());
+
+        return true;
+    }
+
+    if (messageClass == MessageClass::Logging)
+    {
+        YI_LOGE(LOG_TAG, "Log messages must be queued through QueueLogMessage, dropping %s.", pFunctionName);
+        return false;
+    }
+
+    m_statistics.controlMessageCount++;
+    m_lastControlMessageTime = std::chrono::steady_clock::now();
+
+    bool awaitingResponse = pResponseHandlerOwner && responseHandler;
+
+    // counted before the call, the transport may deliver the response before returning
+    if (awaitingResponse)
+    {
+        m_controlMessagesAwaitingResponseCount++;
+    }
+
+    bool messageSent = CYIBitmovinBridgeTransport::GetInstance()->Call(target, pClassName, pInstanceAccessorName, pFunctionName, std::move(command), std::move(arguments), pResponseHandlerOwner, std::move(responseHandler));
+
+    if (awaitingResponse && !messageSent)
+    {
+        OnControlResponseReceived();
+    }
+
+    return messageSent;
+}
+
+void CYIBitmovinBridgeScheduler::OnControlResponseReceived()
+{
+    // responses which arrive after they were given up on while log messages were deferred are no longer counted
+    if (m_controlMessagesAwaitingResponseCount > 0)
+    {
+        m_controlMessagesAwaitingResponseCount--;
+    }
+}
+
+bool CYIBitmovinBridgeScheduler::QueueLogMessage(const char *pClassName, const char *pBatchFunctionName, const char *pLevel, const char *pMessage, size_t messageLength)
+{
+    // during a log storm the newest messages are dropped, a single warning reporting how many were lost is sent with the next batch instead
+    return m_logMessages.Push(pClassName, pBatchFunctionName, pLevel, pMessage, messageLength);
+}
+
+void CYIBitmovinBridgeScheduler::SetLogMessagesHeld(bool held)
+{
+    if (held == m_logMessagesHeld)
+    {
+        return;
+    }
+
+    m_logMessagesHeld = held;
+    m_replayHeldLogMessages = !held;
+}
+
+bool CYIBitmovinBridgeScheduler::AreLogMessagesHeld() const
+{
+    return m_logMessagesHeld;
+}
+
+CYIBitmovinBridgeScheduler::Statistics CYIBitmovinBridgeScheduler::GetStatistics() const
+{
+    Statistics statistics = m_statistics;
+    statistics.droppedLogMessageCount = m_logMessages.GetDroppedMessageCount() + m_failedLogMessageCount;
+    statistics.truncatedLogMessageCount = m_logMessages.GetTruncatedMessageCount();
+
+    return statistics;
+}
+
+void CYIBitmovinBridgeScheduler::ReleaseOnNextTick(std::unique_ptr<CYIBitmovinCommandPipeline> &&pCommandPipeline)
+{
+    m_releasedCommandPipelines.push_back(std::move(pCommandPipeline));
+}
+
+void CYIBitmovinBridgeScheduler::OnTickTimerTimedOut()
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    m_releasedCommandPipelines.clear();
+
+    // control messages never wait for a tick, so only the telemetry and logging queues are drained here, telemetry first
+    SendTelemetryMessages(now);
+    SendLogMessages(now);
+
+    m_tickTimer.Start(static_cast<uint64_t>(m_configuration.tickInterval.count()));
+}
+
+void CYIBitmovinBridgeScheduler::SendTelemetryMessages(std::chrono::steady_clock::time_point now)
+{
+    float elapsedSeconds = std::chrono::duration<float>(now - m_lastTelemetryRefillTime).count();
+    m_telemetryTokens = std::min(m_telemetryTokens + elapsedSeconds * m_configuration.telemetryMessagesPerSecond, static_cast<float>(m_configuration.telemetryBurst));
+    m_lastTelemetryRefillTime = now;
+
+    size_t sentMessageCount = 0;
+
+    while (sentMessageCount < m_telemetryMessages.size() && m_telemetryTokens >= 1.0f)
+    {
+        TelemetryMessage &telemetryMessage = m_telemetryMessages[sentMessageCount];
+
+        if (!CYIBitmovinBridgeTransport::GetInstance()->Call(telemetryMessage.target, telemetryMessage.className.GetData(), telemetryMessage.instanceAccessorName.GetData(), telemetryMessage.functionName.GetData(), std::move(telemetryMessage.command), std::move(telemetryMessage.arguments)))
+        {
+            YI_LOGW(LOG_TAG, "Failed to invoke %s function.", telemetryMessage.functionName.GetData());
+        }
+
+        m_telemetryTokens -= 1.0f;
+        m_statistics.telemetryMessageCount++;
+        sentMessageCount++;
+    }
+
+    m_telemetryMessages.erase(m_telemetryMessages.begin(), m_telemetryMessages.begin() + static_cast<std::ptrdiff_t>(sentMessageCount));
+}
+
+void CYIBitmovinBridgeScheduler::SendLogMessages(std::chrono::steady_clock::time_point now)
+{
+    if (m_logMessagesHeld)
+    {
+        return;
+    }
+
+    if (m_controlMessagesAwaitingResponseCount > 0)
+    {
+        // a log batch sent now would be processed before the responses the control messages are waiting on, unless those responses were lost
+        if (now - m_lastControlMessageTime < m_configuration.maximumLoggingDeferral)
+        {
+            return;
+        }
+
+        m_controlMessagesAwaitingResponseCount = 0;
+    }
+
+    size_t queuedLogMessageCount = m_logMessages.GetSize();
+
+    // spooled messages are replayed all at once, however large the spool has grown, so that they reach the logger in a single transfer
+    bool replayHeldLogMessages = m_replayHeldLogMessages;
+    m_replayHeldLogMessages = false;
+
+    // a backlog larger than one batch is sent on every tick rather than waiting for the logging interval
+    if (queuedLogMessageCount == 0 || (!replayHeldLogMessages && now < m_nextLogBatchTime && queuedLogMessageCount < m_configuration.maximumLogBatchSize))
+    {
+        return;
+    }
+
+    m_nextLogBatchTime = now + m_configuration.loggingInterval;
+
+    uint64_t droppedLogMessageCount = m_logMessages.GetDroppedMessageCount();
+    uint64_t unreportedDroppedLogMessageCount = droppedLogMessageCount - m_reportedDroppedLogMessageCount;
+    m_reportedDroppedLogMessageCount = droppedLogMessageCount;
+
+    const char *pClassName = nullptr;
+    const char *pBatchFunctionName = nullptr;
+    yi::rapidjson::Document command;
+    yi::rapidjson::Value logMessagesValue;
+    size_t logMessageCount = 0;
+
+    // messages are copied out of the log queue straight into the batch, consecutive messages for the same logger share a batch
+    size_t poppedLogMessageCount = m_logMessages.Pop(replayHeldLogMessages ? queuedLogMessageCount : m_configuration.maximumLogBatchSize, [&](const CYIBitmovinLogRingBuffer::Entry &entry) {
+        if (logMessageCount > 0 && (std::strcmp(entry.pClassName, pClassName) != 0 || std::strcmp(entry.pBatchFunctionName, pBatchFunctionName) != 0))
+        {
+            SendLogBatch(pClassName, pBatchFunctionName, std::move(command), std::move(logMessagesValue), logMessageCount);
+            logMessageCount = 0;
+        }
+
+        if (logMessageCount == 0)
+        {
+            pClassName = entry.pClassName;
+            pBatchFunctionName = entry.pBatchFunctionName;
+            command = yi::rapidjson::Document(yi::rapidjson::kObjectType);
+            logMessagesValue = yi::rapidjson::Value(yi::rapidjson::kArrayType);
+
+            if (unreportedDroppedLogMessageCount > 0)
+            {
+                CYIString droppedLogMessagesMessage = CYIString("Dropped ") + std::to_string(unreportedDroppedLogMessageCount).c_str() + " log messages during a log storm.";
+
+                yi::rapidjson::Value logMessageValue(yi::rapidjson::kArrayType);
+                logMessageValue.PushBack(yi::rapidjson::StringRef(DROPPED_LOG_MESSAGES_LEVEL), command.GetAllocator());
+                logMessageValue.PushBack(yi::rapidjson::Value(droppedLogMessagesMessage.GetData(), command.GetAllocator()), command.GetAllocator());
+                logMessagesValue.PushBack(logMessageValue, command.GetAllocator());
+
+                unreportedDroppedLogMessageCount = 0;
+            }
+        }
+
+        yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
+
+        yi::rapidjson::Value logMessageValue(yi::rapidjson::kArrayType);
+        logMessageValue.PushBack(yi::rapidjson::StringRef(entry.pLevel), allocator);
+        logMessageValue.PushBack(yi::rapidjson::Value(entry.pMessage, static_cast<yi::rapidjson::SizeType>(entry.messageLength), allocator), allocator);
+        logMessagesValue.PushBack(logMessageValue, allocator);
+
+        logMessageCount++;
+    });
+
+    if (logMessageCount > 0)
+    {
+        SendLogBatch(pClassName, pBatchFunctionName, std::move(command), std::move(logMessagesValue), logMessageCount);
+    }
+
+    if (replayHeldLogMessages)
+    {
+        m_statistics.replayedLogMessageCount += poppedLogMessageCount;
+    }
+}
+
+void CYIBitmovinBridgeScheduler::SendLogBatch(const char *pClassName, const char *pBatchFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&logMessagesValue, size_t logMessageCount)
+{
+    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
+    arguments.PushBack(logMessagesValue, command.GetAllocator());
+
+    // note: a failure is not logged, since that log message would be queued for the next batch and fail again
+    if (CYIBitmovinBridgeTransport::GetInstance()->Call(Target::Static, pClassName, "", pBatchFunctionName, std::move(command), std::move(arguments)))
+    {
+        m_statistics.logMessageCount += logMessageCount;
+        m_statistics.logBatchCount++;
+    }
+    else
+    {
+        m_failedLogMessageCount += logMessageCount;
+    }
+}
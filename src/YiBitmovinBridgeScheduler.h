@@ -0,0 +1,130 @@
+#ifndef _YI_BITMOVIN_BRIDGE_SCHEDULER_H_
+#define _YI_BITMOVIN_BRIDGE_SCHEDULER_H_
+
+#include "YiBitmovinBridgeTransport.h"
+#include "YiBitmovinLogRingBuffer.h"
+
+#include <signal/YiSignalHandler.h>
+#include <utility/YiTimer.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+class CYIBitmovinCommandPipeline;
+
+// note: every message crossing the web messaging bridge shares a single channel which the JS side processes in order, so messages are
+// split into classes with separate queues: control messages are sent immediately, telemetry is coalesced and sent at a bounded rate,
+// and log messages are sent in bulk, held back while control messages are awaiting their response
+class CYIBitmovinBridgeScheduler : public CYISignalHandler
+{
+public:
+    typedef CYIBitmovinBridgeTransport::Target Target;
+
+    enum class MessageClass
+    {
+        Control,
+        Telemetry,
+        Logging
+    };
+
+    struct Configuration
+    {
+        std::chrono::milliseconds tickInterval{50};
+        uint32_t telemetryMessagesPerSecond = 20;
+        uint32_t telemetryBurst = 4;
+        std::chrono::milliseconds loggingInterval{250};
+        std::chrono::milliseconds maximumLoggingDeferral{1000};
+        size_t maximumLogBatchSize = 100;
+        size_t maximumQueuedLogMessageCount = 2048; // note: the log queue is sized when the scheduler is created, later changes are ignored
+        size_t maximumLogMessageLength = 512; // note: longer log messages are truncated
+    };
+
+    struct Statistics
+    {
+        uint64_t controlMessageCount = 0;
+        uint64_t telemetryMessageCount = 0;
+        uint64_t coalescedTelemetryMessageCount = 0;
+        uint64_t logMessageCount = 0;
+        uint64_t logBatchCount = 0;
+        uint64_t droppedLogMessageCount = 0;
+        uint64_t truncatedLogMessageCount = 0;
+        uint64_t replayedLogMessageCount = 0;
+    };
+
+    // note: must first be called from the main thread, since the scheduler drains its queues from a timer
+    static CYIBitmovinBridgeScheduler &GetInstance();
+
+    // note: the scheduler owns a timer, so it is not destroyed at static destruction, which happens after the engine has shut down. It must
+    // be shut down from the main thread once every player and the remote logger sink are gone, queued messages are dropped. A later call to
+    // GetInstance creates a new scheduler.
+    static void Shutdown();
+
+    void SetConfiguration(const Configuration &configuration);
+    const Configuration &GetConfiguration() const;
+
+    // note: control messages are passed straight to the transport, telemetry messages are copied and only the latest one queued for each
+    // target and function is sent, telemetry messages cannot watch for a response
+    // note: the response handler of a control message is handed to the transport unwrapped, so it must report the response through
+    // OnControlResponseReceived, log batches are held back until it does or the maximum logging deferral has elapsed
+    bool Send(MessageClass messageClass, Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, CYISignalHandler *pResponseHandlerOwner = nullptr, CYIBitmovinBridgeTransport::ResponseHandler &&responseHandler = CYIBitmovinBridgeTransport::ResponseHandler());
+    void OnControlResponseReceived();
+
+    // note: may be called from any thread and never blocks, log messages are delivered to the static batch function of the given class as an
+    // array of [level, message] pairs. Messages queued while the log queue is full are dropped and reported in the next batch.
+    // note: class names, batch function names and levels are not copied and must have static storage duration
+    bool QueueLogMessage(const char *pClassName, const char *pBatchFunctionName, const char *pLevel, const char *pMessage, size_t messageLength);
+
+    // note: while held, log messages are spooled in the log queue rather than sent, once released the spooled messages are replayed in a
+    // single batch on the next tick. Since the log queue is bounded, the earliest messages are kept and later ones dropped if it fills up.
+    // note: must be called from the main thread
+    void SetLogMessagesHeld(bool held);
+    bool AreLogMessagesHeld() const;
+
+    Statistics GetStatistics() const;
+
+    // note: a command pipeline cannot be destroyed from within one of its own callbacks, pipelines handed over here are destroyed on the
+    // next tick instead
+    void ReleaseOnNextTick(std::unique_ptr<CYIBitmovinCommandPipeline> &&pCommandPipeline);
+
+private:
+    struct TelemetryMessage
+    {
+        Target target;
+        CYIString className;
+        CYIString instanceAccessorName;
+        CYIString functionName;
+        yi::rapidjson::Document command;
+        yi::rapidjson::Value arguments; // note: allocated from the command document
+    };
+
+    CYIBitmovinBridgeScheduler();
+    virtual ~CYIBitmovinBridgeScheduler();
+
+    void OnTickTimerTimedOut();
+    void SendTelemetryMessages(std::chrono::steady_clock::time_point now);
+    void SendLogMessages(std::chrono::steady_clock::time_point now);
+    void SendLogBatch(const char *pClassName, const char *pBatchFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&logMessagesValue, size_t logMessageCount);
+
+    static CYIBitmovinBridgeScheduler *s_pInstance;
+
+    Configuration m_configuration;
+    std::vector<TelemetryMessage> m_telemetryMessages;
+    float m_telemetryTokens;
+    std::chrono::steady_clock::time_point m_lastTelemetryRefillTime;
+    std::chrono::steady_clock::time_point m_nextLogBatchTime;
+    std::chrono::steady_clock::time_point m_lastControlMessageTime;
+    size_t m_controlMessagesAwaitingResponseCount;
+    Statistics m_statistics;
+    std::vector<std::unique_ptr<CYIBitmovinCommandPipeline>> m_releasedCommandPipelines;
+    CYITimer m_tickTimer;
+
+    // note: written from the logging threads without a lock, everything else about log messages is only touched from the main thread
+    CYIBitmovinLogRingBuffer m_logMessages;
+    uint64_t m_failedLogMessageCount;
+    uint64_t m_reportedDroppedLogMessageCount;
+    bool m_logMessagesHeld;
+    bool m_replayHeldLogMessages;
+};
+
+#endif // _YI_BITMOVIN_BRIDGE_SCHEDULER_H_
@@ -0,0 +1,164 @@
+#include "YiBitmovinBridgeTransport.h"
+
+#include <platform/YiWebBridgeLocator.h>
+
+#include <memory>
+
+#define LOG_TAG "CYIBitmovinBridgeTransport"
+
+static CYIBitmovinBridgeTransport *s_pTransport = nullptr;
+
+static CYIWebMessagingBridge::FutureResponse CallWebMessagingBridgeFunction(CYIWebMessagingBridge *pWebMessagingBridge, CYIBitmovinBridgeTransport::Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, bool *pMessageSent)
+{
+    if (target == CYIBitmovinBridgeTransport::Target::Static)
+    {
+        return pWebMessagingBridge->CallStaticFunctionWithArgs(std::move(command), pClassName, pFunctionName, std::move(arguments), pMessageSent);
+    }
+
+    return pWebMessagingBridge->CallInstanceFunctionWithArgs(std::move(command), pClassName, pInstanceAccessorName, pFunctionName, std::move(arguments), yi::rapidjson::Value(yi::rapidjson::kArrayType), pMessageSent);
+}
+
+static CYIBitmovinBridgeTransport::Response ConvertResponse(const CYIWebMessagingBridge::Response &webMessagingBridgeResponse)
+{
+    CYIBitmovinBridgeTransport::Response response;
+
+    if (webMessagingBridgeResponse.HasError())
+    {
+        response.hasError = true;
+        response.errorMessage = webMessagingBridgeResponse.GetError()->GetStacktrace();
+    }
+    else
+    {
+        response.pResult = webMessagingBridgeResponse.GetResult();
+    }
+
+    return response;
+}
+
+CYIBitmovinBridgeTransport *CYIBitmovinBridgeTransport::GetInstance()
+{
+    static CYIBitmovinWebBridgeTransport webBridgeTransport;
+
+    return s_pTransport ? s_pTransport : &webBridgeTransport;
+}
+
+void CYIBitmovinBridgeTransport::SetInstance(CYIBitmovinBridgeTransport *pTransport)
+{
+    s_pTransport = pTransport;
+}
+
+bool CYIBitmovinWebBridgeTransport::IsConnected() const
+{
+    return CYIWebBridgeLocator::GetWebMessagingBridge() != nullptr;
+}
+
+bool CYIBitmovinWebBridgeTransport::Call(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, CYISignalHandler *pResponseHandlerOwner, ResponseHandler &&responseHandler)
+{
+    CYIWebMessagingBridge *pWebMessagingBridge = CYIWebBridgeLocator::GetWebMessagingBridge();
+
+    if (!pWebMessagingBridge)
+    {
+        return false;
+    }
+
+    bool messageSent = false;
+    CYIWebMessagingBridge::FutureResponse futureResponse = CallWebMessagingBridgeFunction(pWebMessagingBridge, target, pClassName, pInstanceAccessorName, pFunctionName, std::move(command), std::move(arguments), &messageSent);
+
+    if (!messageSent)
+    {
+        return false;
+    }
+
+    if (!pResponseHandlerOwner || !responseHandler)
+    {
+        return true;
+    }
+
+    // the completion signal and the poll below may both see the same response, only the first one to run delivers it
+    std::shared_ptr<bool> pDelivered(new bool(false));
+
+    std::function<void(const CYIWebMessagingBridge::Response &response)> handler([responseHandler, pDelivered](const CYIWebMessagingBridge::Response &webMessagingBridgeResponse) {
+        if (*pDelivered)
+        {
+            return;
+        }
+
+        *pDelivered = true;
+        responseHandler(ConvertResponse(webMessagingBridgeResponse));
+    });
+
+    futureResponse.pCompleted->Connect(*pResponseHandlerOwner, handler, EYIConnectionType::Async);
+
+    // the response may already have been assigned before the completion signal was connected, poll it once without waiting
+    bool valueAssigned = false;
+    CYIWebMessagingBridge::Response response = futureResponse.Take(0, &valueAssigned);
+
+    if (valueAssigned)
+    {
+        handler(response);
+    }
+
+    return true;
+}
+
+CYIBitmovinBridgeTransport::CallStatus CYIBitmovinWebBridgeTransport::CallAndWait(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, uint64_t timeoutMs, const ResponseHandler &responseHandler)
+{
+    CYIWebMessagingBridge *pWebMessagingBridge = CYIWebBridgeLocator::GetWebMessagingBridge();
+
+    if (!pWebMessagingBridge)
+    {
+        return CallStatus::NotSent;
+    }
+
+    bool messageSent = false;
+    CYIWebMessagingBridge::FutureResponse futureResponse = CallWebMessagingBridgeFunction(pWebMessagingBridge, target, pClassName, pInstanceAccessorName, pFunctionName, std::move(command), std::move(arguments), &messageSent);
+
+    if (!messageSent)
+    {
+        return CallStatus::NotSent;
+    }
+
+    bool valueAssigned = false;
+    CYIWebMessagingBridge::Response response = futureResponse.Take(timeoutMs, &valueAssigned);
+
+    if (!valueAssigned)
+    {
+        return CallStatus::TimedOut;
+    }
+
+    if (responseHandler)
+    {
+        responseHandler(ConvertResponse(response));
+    }
+
+    return CallStatus::Received;
+}
+
+uint64_t CYIBitmovinWebBridgeTransport::RegisterEventHandler(const CYIString &contextName, EventHandler &&eventHandler)
+{
+    CYIWebMessagingBridge *pWebMessagingBridge = CYIWebBridgeLocator::GetWebMessagingBridge();
+
+    if (!pWebMessagingBridge)
+    {
+        YI_LOGE(LOG_TAG, "Failed to register %s event handler.", contextName.GetData());
+        return 0;
+    }
+
+    yi::rapidjson::Document filter(yi::rapidjson::kObjectType);
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = filter.GetAllocator();
+
+    yi::rapidjson::Value contextNameValue(contextName.GetData(), allocator);
+    filter.AddMember(yi::rapidjson::StringRef(CYIWebMessagingBridge::EVENT_CONTEXT_ATTRIBUTE_NAME), contextNameValue, allocator);
+
+    return pWebMessagingBridge->RegisterEventHandler(std::move(filter), std::move(eventHandler));
+}
+
+void CYIBitmovinWebBridgeTransport::UnregisterEventHandler(uint64_t eventHandlerId)
+{
+    CYIWebMessagingBridge *pWebMessagingBridge = CYIWebBridgeLocator::GetWebMessagingBridge();
+
+    if (pWebMessagingBridge)
+    {
+        pWebMessagingBridge->UnregisterEventHandler(eventHandlerId);
+    }
+}
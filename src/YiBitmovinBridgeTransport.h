@@ -0,0 +1,69 @@
+#ifndef _YI_BITMOVIN_BRIDGE_TRANSPORT_H_
+#define _YI_BITMOVIN_BRIDGE_TRANSPORT_H_
+
+#include <signal/YiSignalHandler.h>
+#include <utility/YiRapidJSONUtility.h>
+
+#include <functional>
+
+class CYIBitmovinBridgeTransport
+{
+public:
+    enum class Target
+    {
+        Static,
+        Instance
+    };
+
+    enum class CallStatus
+    {
+        NotSent,
+        TimedOut,
+        Received
+    };
+
+    struct Response
+    {
+        bool hasError = false;
+        CYIString errorMessage;
+        const yi::rapidjson::Value *pResult = nullptr;
+    };
+
+    typedef std::function<void(const Response &response)> ResponseHandler;
+    typedef std::function<void(const yi::rapidjson::Value &eventValue)> EventHandler;
+
+    virtual ~CYIBitmovinBridgeTransport() = default;
+
+    // note: the web messaging bridge transport is used unless another transport has been set, the transport is not owned
+    static CYIBitmovinBridgeTransport *GetInstance();
+    static void SetInstance(CYIBitmovinBridgeTransport *pTransport);
+
+    virtual bool IsConnected() const = 0;
+
+    // note: names are passed as plain strings so that interned names reach the transport without being copied, they are only read
+    // during the call
+    // note: the response handler is invoked exactly once, either before Call returns if the response is already available or later from the
+    // response handler owner's thread, and is dropped if the owner is destroyed first. No response is watched for if the owner is null.
+    virtual bool Call(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, CYISignalHandler *pResponseHandlerOwner = nullptr, ResponseHandler &&responseHandler = ResponseHandler()) = 0;
+
+    // note: the response handler is only invoked if a response is received within the timeout
+    virtual CallStatus CallAndWait(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, uint64_t timeoutMs, const ResponseHandler &responseHandler) = 0;
+
+    virtual uint64_t RegisterEventHandler(const CYIString &contextName, EventHandler &&eventHandler) = 0;
+    virtual void UnregisterEventHandler(uint64_t eventHandlerId) = 0;
+};
+
+class CYIBitmovinWebBridgeTransport : public CYIBitmovinBridgeTransport
+{
+public:
+    CYIBitmovinWebBridgeTransport() = default;
+    virtual ~CYIBitmovinWebBridgeTransport() = default;
+
+    virtual bool IsConnected() const override;
+    virtual bool Call(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, CYISignalHandler *pResponseHandlerOwner = nullptr, ResponseHandler &&responseHandler = ResponseHandler()) override;
+    virtual CallStatus CallAndWait(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, uint64_t timeoutMs, const ResponseHandler &responseHandler) override;
+    virtual uint64_t RegisterEventHandler(const CYIString &contextName, EventHandler &&eventHandler) override;
+    virtual void UnregisterEventHandler(uint64_t eventHandlerId) override;
+};
+
+#endif // _YI_BITMOVIN_BRIDGE_TRANSPORT_H_
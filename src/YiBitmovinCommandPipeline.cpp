@@ -0,0 +1,688 @@
+#include "YiBitmovinCommandPipeline.h"
+
+#include <algorithm>
+#include <cstring>
+
+#define LOG_TAG "CYIBitmovinCommandPipeline"
+
+static const char *EXECUTE_COMMAND_BATCH_FUNCTION_NAME = "executeCommandBatch";
+static const char *COMMAND_INSTANCE_ATTRIBUTE_NAME = "instance";
+static const char *COMMAND_INSTANCE_ID_ATTRIBUTE_NAME = "instanceId";
+static const char *COMMAND_FUNCTION_NAME_ATTRIBUTE_NAME = "functionName";
+static const char *COMMAND_ARGUMENTS_ATTRIBUTE_NAME = "arguments";
+static const char *COMMAND_RESULT_ATTRIBUTE_NAME = "result";
+static const char *COMMAND_ERROR_ATTRIBUTE_NAME = "error";
+static const uint64_t FIRE_AND_FORGET_COMMAND_ID = 0;
+static const size_t COMMAND_ARENA_INITIAL_CAPACITY = 16 * 1024;
+static const size_t MAX_CANCELLED_COMMAND_COUNT = 32;
+
+CYIBitmovinCommandPipeline::CYIBitmovinCommandPipeline(const CYIString &className, const CYIString &instanceAccessorName, uint64_t instanceId)
+    : m_className(className)
+    , m_instanceAccessorName(instanceAccessorName)
+    , m_instanceId(instanceId)
+    , m_nextCommandId(1)
+    , m_flushing(false)
+    , m_pCommandArenaBuffer(new char[COMMAND_ARENA_INITIAL_CAPACITY])
+    , m_commandArenaBufferSize(COMMAND_ARENA_INITIAL_CAPACITY)
+    , m_pCommandArena(new yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator>(m_pCommandArenaBuffer.get(), m_commandArenaBufferSize))
+    , m_pLatencyRecorder(nullptr)
+{
+    m_batchTimer.TimedOut.Connect(*this, &CYIBitmovinCommandPipeline::OnBatchTimerTimedOut);
+    m_timeoutTimer.TimedOut.Connect(*this, &CYIBitmovinCommandPipeline::OnTimeoutTimerTimedOut);
+}
+
+CYIBitmovinCommandPipeline::~CYIBitmovinCommandPipeline()
+{
+    m_batchTimer.Stop();
+    m_timeoutTimer.Stop();
+
+    // queued command documents reference the arena, so they are released first
+    m_queuedCommands.clear();
+    m_sendingCommands.clear();
+}
+
+yi::rapidjson::Document CYIBitmovinCommandPipeline::CreateCommand()
+{
+    return yi::rapidjson::Document(yi::rapidjson::kObjectType, m_pCommandArena.get());
+}
+
+void CYIBitmovinCommandPipeline::SetLatencyRecorder(CYIBitmovinLatencyRecorder *pLatencyRecorder)
+{
+    m_pLatencyRecorder = pLatencyRecorder;
+}
+
+void CYIBitmovinCommandPipeline::SetFailureCallback(FailureCallback &&failureCallback)
+{
+    m_failureCallback = std::move(failureCallback);
+}
+
+bool CYIBitmovinCommandPipeline::Send(Target target, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, CompletionCallback &&completionCallback, uint64_t timeoutMs, bool reportFailure)
+{
+    if (!CYIBitmovinBridgeTransport::GetInstance()->IsConnected())
+    {
+        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", pFunctionName);
+
+        Result result;
+        result.errorMessage = CYIString("Failed to invoke ") + pFunctionName + " function.";
+
+        if (reportFailure && m_failureCallback)
+        {
+            m_failureCallback(pFunctionName, result);
+        }
+
+        if (completionCallback)
+        {
+            completionCallback(result);
+        }
+
+        return false;
+    }
+
+    uint64_t commandId = m_nextCommandId++;
+
+    if (m_pLatencyRecorder)
+    {
+        timeoutMs = m_pLatencyRecorder->GetTimeoutMs(pFunctionName, timeoutMs);
+    }
+
+    // note: command ids increase monotonically, so appending keeps the pending commands sorted by id
+    PendingCommand pendingCommand;
+    pendingCommand.commandId = commandId;
+    pendingCommand.pFunctionName = pFunctionName;
+    pendingCommand.completionCallback = std::move(completionCallback);
+    pendingCommand.reportFailure = reportFailure;
+    pendingCommand.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+
+    m_pendingCommands.push_back(std::move(pendingCommand));
+
+    QueuedCommand queuedCommand;
+    queuedCommand.commandId = commandId;
+    queuedCommand.target = target;
+    queuedCommand.pFunctionName = pFunctionName;
+    queuedCommand.command = std::move(command);
+    queuedCommand.arguments = std::move(arguments);
+
+    Enqueue(std::move(queuedCommand));
+
+    return true;
+}
+
+bool CYIBitmovinCommandPipeline::SendLatest(Target target, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments)
+{
+    if (!CYIBitmovinBridgeTransport::GetInstance()->IsConnected())
+    {
+        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", pFunctionName);
+        return false;
+    }
+
+    // fire and forget commands are not tracked as pending, only the latest one queued during the current update tick is handed to the scheduler
+    for (QueuedCommand &queuedCommand : m_queuedCommands)
+    {
+        if (queuedCommand.commandId == FIRE_AND_FORGET_COMMAND_ID && queuedCommand.target == target && std::strcmp(queuedCommand.pFunctionName, pFunctionName) == 0)
+        {
+            queuedCommand.command = std::move(command);
+            queuedCommand.arguments = std::move(arguments);
+            return true;
+        }
+    }
+
+    QueuedCommand queuedCommand;
+    queuedCommand.commandId = FIRE_AND_FORGET_COMMAND_ID;
+    queuedCommand.target = target;
+    queuedCommand.pFunctionName = pFunctionName;
+    queuedCommand.command = std::move(command);
+    queuedCommand.arguments = std::move(arguments);
+
+    Enqueue(std::move(queuedCommand));
+
+    return true;
+}
+
+void CYIBitmovinCommandPipeline::Flush()
+{
+    m_batchTimer.Stop();
+
+    if (m_queuedCommands.empty())
+    {
+        return;
+    }
+
+    // the sending command list is reused to avoid reallocating it on every flush, unless a completion callback flushes again while sending
+    bool outermostFlush = !m_flushing;
+    std::vector<QueuedCommand> nestedQueuedCommands;
+    std::vector<QueuedCommand> &queuedCommands = outermostFlush ? m_sendingCommands : nestedQueuedCommands;
+    queuedCommands.swap(m_queuedCommands);
+
+    m_flushing = true;
+
+    // fire and forget commands only carry telemetry such as the video rectangle, they are handed to the scheduler's rate bounded
+    // telemetry queue after the control commands have been sent, so that they can never delay them
+    // note: the control commands are moved to the front in place, keeping their order, rather than with std::stable_partition which
+    // allocates a temporary buffer. The order of the telemetry commands does not matter, each one is for a different function.
+    size_t controlCommandCount = 0;
+
+    for (size_t i = 0; i < queuedCommands.size(); i++)
+    {
+        if (queuedCommands[i].commandId != FIRE_AND_FORGET_COMMAND_ID)
+        {
+            if (i != controlCommandCount)
+            {
+                std::swap(queuedCommands[controlCommandCount], queuedCommands[i]);
+            }
+
+            controlCommandCount++;
+        }
+    }
+
+    std::vector<QueuedCommand>::iterator telemetryCommandsIterator = queuedCommands.begin() + static_cast<std::ptrdiff_t>(controlCommandCount);
+
+    if (controlCommandCount == 1)
+    {
+        SendQueuedCommand(queuedCommands.front());
+    }
+    else if (controlCommandCount > 1)
+    {
+        SendQueuedCommandBatch(queuedCommands, controlCommandCount);
+    }
+
+    for (std::vector<QueuedCommand>::iterator queuedCommandIterator = telemetryCommandsIterator; queuedCommandIterator != queuedCommands.end(); ++queuedCommandIterator)
+    {
+        CYIBitmovinBridgeScheduler::GetInstance().Send(CYIBitmovinBridgeScheduler::MessageClass::Telemetry, queuedCommandIterator->target, m_className.GetData(), m_instanceAccessorName.GetData(), queuedCommandIterator->pFunctionName, std::move(queuedCommandIterator->command), std::move(queuedCommandIterator->arguments));
+    }
+
+    queuedCommands.clear();
+
+    if (outermostFlush)
+    {
+        m_flushing = false;
+
+        // the web messaging bridge serializes each message before returning, so the arena can be reset once nothing queued references it
+        if (m_queuedCommands.empty())
+        {
+            ResetCommandArena();
+        }
+    }
+
+    ScheduleTimeoutTimer();
+}
+
+void CYIBitmovinCommandPipeline::CancelAll()
+{
+    m_queuedCommands.clear();
+    m_pendingCommands.clear();
+    m_cancelledCommands.clear();
+    m_commandBatches.clear();
+    m_batchTimer.Stop();
+    m_timeoutTimer.Stop();
+
+    if (!m_flushing)
+    {
+        ResetCommandArena();
+    }
+}
+
+size_t CYIBitmovinCommandPipeline::GetPendingCommandCount() const
+{
+    return m_pendingCommands.size();
+}
+
+void CYIBitmovinCommandPipeline::SendQueuedCommand(QueuedCommand &queuedCommand)
+{
+    uint64_t commandId = queuedCommand.commandId;
+    CYIBitmovinBridgeTransport::ResponseHandler responseHandler([this, commandId](const CYIBitmovinBridgeTransport::Response &response) {
+        OnResponseReceived(commandId, response);
+    });
+
+    // the command is marked as sent first, the transport may deliver an already available response before the send returns
+    MarkSent(commandId, std::chrono::steady_clock::now());
+
+    bool messageSent = CYIBitmovinBridgeScheduler::GetInstance().Send(CYIBitmovinBridgeScheduler::MessageClass::Control, queuedCommand.target, m_className.GetData(), m_instanceAccessorName.GetData(), queuedCommand.pFunctionName, std::move(queuedCommand.command), std::move(queuedCommand.arguments), this, std::move(responseHandler));
+
+    if (!messageSent)
+    {
+        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", queuedCommand.pFunctionName);
+
+        MarkSent(commandId, std::chrono::steady_clock::time_point());
+        Fail(commandId, CYIString("Failed to invoke ") + queuedCommand.pFunctionName + " function.");
+    }
+}
+
+void CYIBitmovinCommandPipeline::SendQueuedCommandBatch(std::vector<QueuedCommand> &queuedCommands, size_t commandCount)
+{
+    yi::rapidjson::Document command(CreateCommand());
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
+
+    yi::rapidjson::Value commandBatchValue(yi::rapidjson::kArrayType);
+    commandBatchValue.Reserve(static_cast<yi::rapidjson::SizeType>(commandCount), allocator);
+
+    for (size_t i = 0; i < commandCount; i++)
+    {
+        QueuedCommand &queuedCommand = queuedCommands[i];
+
+        yi::rapidjson::Value commandValue(yi::rapidjson::kObjectType);
+
+        commandValue.AddMember(yi::rapidjson::StringRef(COMMAND_INSTANCE_ATTRIBUTE_NAME), yi::rapidjson::Value(queuedCommand.target == Target::Instance), allocator);
+
+        if (queuedCommand.target == Target::Instance && m_instanceId != 0)
+        {
+            commandValue.AddMember(yi::rapidjson::StringRef(COMMAND_INSTANCE_ID_ATTRIBUTE_NAME), yi::rapidjson::Value(m_instanceId), allocator);
+        }
+
+        commandValue.AddMember(yi::rapidjson::StringRef(COMMAND_FUNCTION_NAME_ATTRIBUTE_NAME), yi::rapidjson::StringRef(queuedCommand.pFunctionName), allocator);
+
+        // the arguments are moved rather than copied, the queued command documents outlive the batch message until it has been sent
+        commandValue.AddMember(yi::rapidjson::StringRef(COMMAND_ARGUMENTS_ATTRIBUTE_NAME), queuedCommand.arguments, allocator);
+
+        commandBatchValue.PushBack(commandValue, allocator);
+    }
+
+    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
+    arguments.PushBack(commandBatchValue, allocator);
+
+    CommandBatch commandBatch;
+    commandBatch.firstCommandId = queuedCommands.front().commandId;
+    commandBatch.commandCount = commandCount;
+
+    // batches whose response was lost are forgotten once none of their commands are waiting for it, the list is reused between flushes
+    m_commandBatches.erase(std::remove_if(m_commandBatches.begin(), m_commandBatches.end(), [this](const CommandBatch &sentCommandBatch) {
+        return !IsAwaitingResponse(sentCommandBatch);
+    }), m_commandBatches.end());
+
+    m_commandBatches.push_back(commandBatch);
+
+    uint64_t firstCommandId = commandBatch.firstCommandId;
+    CYIBitmovinBridgeTransport::ResponseHandler responseHandler([this, firstCommandId](const CYIBitmovinBridgeTransport::Response &response) {
+        OnBatchResponseReceived(firstCommandId, response);
+    });
+
+    std::chrono::steady_clock::time_point sendTime = std::chrono::steady_clock::now();
+
+    for (uint64_t commandId = firstCommandId; commandId < firstCommandId + commandCount; commandId++)
+    {
+        MarkSent(commandId, sendTime);
+    }
+
+    bool messageSent = CYIBitmovinBridgeScheduler::GetInstance().Send(CYIBitmovinBridgeScheduler::MessageClass::Control, Target::Static, m_className.GetData(), m_instanceAccessorName.GetData(), EXECUTE_COMMAND_BATCH_FUNCTION_NAME, std::move(command), std::move(arguments), this, std::move(responseHandler));
+
+    if (!messageSent)
+    {
+        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", EXECUTE_COMMAND_BATCH_FUNCTION_NAME);
+
+        m_commandBatches.pop_back();
+
+        for (uint64_t commandId = firstCommandId; commandId < firstCommandId + commandCount; commandId++)
+        {
+            MarkSent(commandId, std::chrono::steady_clock::time_point());
+            Fail(commandId, CYIString("Failed to invoke ") + EXECUTE_COMMAND_BATCH_FUNCTION_NAME + " function.");
+        }
+    }
+}
+
+void CYIBitmovinCommandPipeline::OnResponseReceived(uint64_t commandId, const CYIBitmovinBridgeTransport::Response &response)
+{
+    CYIBitmovinBridgeScheduler::GetInstance().OnControlResponseReceived();
+
+    if (FindPendingCommand(commandId) == m_pendingCommands.end())
+    {
+        // the command has already been completed, timed out or was cancelled
+        DropLateResponse(commandId);
+        return;
+    }
+
+    Result result;
+
+    if (response.hasError)
+    {
+        result.errorMessage = response.errorMessage;
+
+        YI_LOGE(LOG_TAG, "%s", result.errorMessage.GetData());
+    }
+    else
+    {
+        result.success = true;
+        result.pValue = response.pResult;
+    }
+
+    Complete(commandId, result);
+}
+
+void CYIBitmovinCommandPipeline::OnBatchResponseReceived(uint64_t firstCommandId, const CYIBitmovinBridgeTransport::Response &response)
+{
+    CYIBitmovinBridgeScheduler::GetInstance().OnControlResponseReceived();
+
+    std::vector<CommandBatch>::iterator commandBatchIterator = std::lower_bound(m_commandBatches.begin(), m_commandBatches.end(), firstCommandId, [](const CommandBatch &commandBatch, uint64_t id) {
+        return commandBatch.firstCommandId < id;
+    });
+
+    if (commandBatchIterator == m_commandBatches.end() || commandBatchIterator->firstCommandId != firstCommandId)
+    {
+        // the batch was forgotten after all of its commands were completed or cancelled
+        return;
+    }
+
+    size_t commandCount = commandBatchIterator->commandCount;
+    m_commandBatches.erase(commandBatchIterator);
+
+    // when every command in the batch has already timed out, the batch result is dropped without being parsed
+    bool pending = false;
+
+    for (uint64_t commandId = firstCommandId; commandId < firstCommandId + commandCount; commandId++)
+    {
+        if (FindPendingCommand(commandId) != m_pendingCommands.end())
+        {
+            pending = true;
+        }
+        else
+        {
+            DropLateResponse(commandId);
+        }
+    }
+
+    if (!pending)
+    {
+        return;
+    }
+
+    if (response.hasError)
+    {
+        const CYIString &errorMessage = response.errorMessage;
+
+        YI_LOGE(LOG_TAG, "%s", errorMessage.GetData());
+
+        for (uint64_t commandId = firstCommandId; commandId < firstCommandId + commandCount; commandId++)
+        {
+            Fail(commandId, errorMessage);
+        }
+
+        return;
+    }
+
+    const yi::rapidjson::Value *pData = response.pResult;
+
+    if (!pData || !pData->IsArray() || pData->Size() != commandCount)
+    {
+        YI_LOGE(LOG_TAG, "%s expected an array of %zu command results, received: %s", EXECUTE_COMMAND_BATCH_FUNCTION_NAME, commandCount, pData ? CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData() : "nothing");
+
+        for (uint64_t commandId = firstCommandId; commandId < firstCommandId + commandCount; commandId++)
+        {
+            Fail(commandId, CYIString("Invalid ") + EXECUTE_COMMAND_BATCH_FUNCTION_NAME + " response.");
+        }
+
+        return;
+    }
+
+    for (yi::rapidjson::SizeType i = 0; i < pData->Size(); i++)
+    {
+        const yi::rapidjson::Value &commandResultValue = (*pData)[i];
+        uint64_t commandId = firstCommandId + i;
+
+        if (FindPendingCommand(commandId) == m_pendingCommands.end())
+        {
+            continue;
+        }
+
+        Result result;
+
+        if (!commandResultValue.IsObject())
+        {
+            result.errorMessage = CYIString("Invalid ") + EXECUTE_COMMAND_BATCH_FUNCTION_NAME + " command result, expected object.";
+        }
+        else if (commandResultValue.HasMember(COMMAND_ERROR_ATTRIBUTE_NAME))
+        {
+            const yi::rapidjson::Value &errorValue = commandResultValue[COMMAND_ERROR_ATTRIBUTE_NAME];
+
+            if (errorValue.IsObject() && errorValue.HasMember(CYIWebMessagingBridge::ERROR_MESSAGE_ATTRIBUTE_NAME) && errorValue[CYIWebMessagingBridge::ERROR_MESSAGE_ATTRIBUTE_NAME].IsString())
+            {
+                result.errorMessage = errorValue[CYIWebMessagingBridge::ERROR_MESSAGE_ATTRIBUTE_NAME].GetString();
+            }
+            else
+            {
+                result.errorMessage = CYIRapidJSONUtility::CreateStringFromValue(errorValue);
+            }
+
+            YI_LOGE(LOG_TAG, "%s", result.errorMessage.GetData());
+        }
+        else
+        {
+            result.success = true;
+
+            if (commandResultValue.HasMember(COMMAND_RESULT_ATTRIBUTE_NAME))
+            {
+                result.pValue = &commandResultValue[COMMAND_RESULT_ATTRIBUTE_NAME];
+            }
+        }
+
+        Complete(commandId, result);
+    }
+}
+
+void CYIBitmovinCommandPipeline::OnBatchTimerTimedOut()
+{
+    Flush();
+}
+
+void CYIBitmovinCommandPipeline::OnTimeoutTimerTimedOut()
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    // the ids are collected first since completing a command erases it, the list is reused between ticks
+    m_timedOutCommandIds.clear();
+
+    for (const PendingCommand &pendingCommand : m_pendingCommands)
+    {
+        if (pendingCommand.deadline <= now)
+        {
+            m_timedOutCommandIds.push_back(pendingCommand.commandId);
+        }
+    }
+
+    for (uint64_t commandId : m_timedOutCommandIds)
+    {
+        std::vector<PendingCommand>::iterator pendingCommandIterator = FindPendingCommand(commandId);
+
+        if (pendingCommandIterator == m_pendingCommands.end())
+        {
+            continue;
+        }
+
+        YI_LOGE(LOG_TAG, "%s did not receive a response from the web messaging bridge!", pendingCommandIterator->pFunctionName);
+
+        Result result;
+        result.timedOut = true;
+        result.errorMessage = CYIString(pendingCommandIterator->pFunctionName) + " did not receive a response from the web messaging bridge.";
+
+        Cancel(pendingCommandIterator);
+        Complete(commandId, result);
+    }
+
+    ScheduleTimeoutTimer();
+}
+
+void CYIBitmovinCommandPipeline::Fail(uint64_t commandId, const CYIString &errorMessage)
+{
+    Result result;
+    result.errorMessage = errorMessage;
+
+    Complete(commandId, result);
+}
+
+void CYIBitmovinCommandPipeline::Complete(uint64_t commandId, const Result &result)
+{
+    std::vector<PendingCommand>::iterator pendingCommandIterator = FindPendingCommand(commandId);
+
+    if (pendingCommandIterator == m_pendingCommands.end())
+    {
+        return;
+    }
+
+    if (m_pLatencyRecorder)
+    {
+        // commands which failed before being sent have no meaningful latency and are only counted as errors
+        if (result.timedOut)
+        {
+            m_pLatencyRecorder->RecordTimeout(pendingCommandIterator->pFunctionName);
+        }
+        else if (pendingCommandIterator->sendTime != std::chrono::steady_clock::time_point())
+        {
+            m_pLatencyRecorder->RecordLatency(pendingCommandIterator->pFunctionName, std::chrono::steady_clock::now() - pendingCommandIterator->sendTime);
+        }
+
+        if (!result.success && !result.timedOut)
+        {
+            m_pLatencyRecorder->RecordError(pendingCommandIterator->pFunctionName);
+        }
+    }
+
+    // the pending command is removed before its callbacks are invoked so that the callbacks can safely send new commands
+    const char *pFunctionName = pendingCommandIterator->pFunctionName;
+    bool reportFailure = pendingCommandIterator->reportFailure;
+    CompletionCallback completionCallback = std::move(pendingCommandIterator->completionCallback);
+    m_pendingCommands.erase(pendingCommandIterator);
+
+    if (!result.success && reportFailure && m_failureCallback)
+    {
+        m_failureCallback(pFunctionName, result);
+    }
+
+    if (completionCallback)
+    {
+        completionCallback(result);
+    }
+}
+
+void CYIBitmovinCommandPipeline::Cancel(std::vector<PendingCommand>::iterator pendingCommandIterator)
+{
+    // the late response of a cancelled command is dropped on arrival, but its latency is still recorded so that the adaptive timeout can grow
+    if (pendingCommandIterator->sendTime == std::chrono::steady_clock::time_point())
+    {
+        return;
+    }
+
+    if (m_cancelledCommands.size() >= MAX_CANCELLED_COMMAND_COUNT)
+    {
+        m_cancelledCommands.erase(m_cancelledCommands.begin());
+    }
+
+    CancelledCommand cancelledCommand;
+    cancelledCommand.commandId = pendingCommandIterator->commandId;
+    cancelledCommand.pFunctionName = pendingCommandIterator->pFunctionName;
+    cancelledCommand.sendTime = pendingCommandIterator->sendTime;
+
+    m_cancelledCommands.push_back(cancelledCommand);
+}
+
+bool CYIBitmovinCommandPipeline::DropLateResponse(uint64_t commandId)
+{
+    std::vector<CancelledCommand>::iterator cancelledCommandIterator = std::find_if(m_cancelledCommands.begin(), m_cancelledCommands.end(), [commandId](const CancelledCommand &cancelledCommand) {
+        return cancelledCommand.commandId == commandId;
+    });
+
+    if (cancelledCommandIterator == m_cancelledCommands.end())
+    {
+        return false;
+    }
+
+    if (m_pLatencyRecorder)
+    {
+        m_pLatencyRecorder->RecordLatency(cancelledCommandIterator->pFunctionName, std::chrono::steady_clock::now() - cancelledCommandIterator->sendTime);
+    }
+
+    m_cancelledCommands.erase(cancelledCommandIterator);
+
+    return true;
+}
+
+bool CYIBitmovinCommandPipeline::IsAwaitingResponse(const CommandBatch &commandBatch)
+{
+    for (uint64_t commandId = commandBatch.firstCommandId; commandId < commandBatch.firstCommandId + commandBatch.commandCount; commandId++)
+    {
+        if (FindPendingCommand(commandId) != m_pendingCommands.end())
+        {
+            return true;
+        }
+
+        bool cancelled = std::any_of(m_cancelledCommands.begin(), m_cancelledCommands.end(), [commandId](const CancelledCommand &cancelledCommand) {
+            return cancelledCommand.commandId == commandId;
+        });
+
+        if (cancelled)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void CYIBitmovinCommandPipeline::ScheduleTimeoutTimer()
+{
+    m_timeoutTimer.Stop();
+
+    if (m_pendingCommands.empty())
+    {
+        return;
+    }
+
+    std::chrono::steady_clock::time_point earliestDeadline = m_pendingCommands.front().deadline;
+
+    for (const PendingCommand &pendingCommand : m_pendingCommands)
+    {
+        earliestDeadline = std::min(earliestDeadline, pendingCommand.deadline);
+    }
+
+    std::chrono::steady_clock::duration timeRemaining = earliestDeadline - std::chrono::steady_clock::now();
+    int64_t timeRemainingMs = std::chrono::duration_cast<std::chrono::milliseconds>(timeRemaining).count();
+
+    m_timeoutTimer.Start(static_cast<uint64_t>(std::max<int64_t>(timeRemainingMs, 0) + 1));
+}
+
+void CYIBitmovinCommandPipeline::Enqueue(QueuedCommand &&queuedCommand)
+{
+    m_queuedCommands.push_back(std::move(queuedCommand));
+
+    // all commands issued during the current update tick are sent together once the batch timer fires
+    if (m_queuedCommands.size() == 1)
+    {
+        m_batchTimer.Start(0);
+    }
+}
+
+void CYIBitmovinCommandPipeline::ResetCommandArena()
+{
+    // when the previous update tick overflowed the arena buffer, it is grown to fit so that later ticks do not need extra chunks
+    if (m_pCommandArena->Capacity() > m_commandArenaBufferSize)
+    {
+        m_commandArenaBufferSize = m_pCommandArena->Capacity();
+        m_pCommandArena.reset();
+        m_pCommandArenaBuffer.reset(new char[m_commandArenaBufferSize]);
+        m_pCommandArena.reset(new yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator>(m_pCommandArenaBuffer.get(), m_commandArenaBufferSize));
+    }
+    else
+    {
+        m_pCommandArena->Clear();
+    }
+}
+
+void CYIBitmovinCommandPipeline::MarkSent(uint64_t commandId, std::chrono::steady_clock::time_point sendTime)
+{
+    std::vector<PendingCommand>::iterator pendingCommandIterator = FindPendingCommand(commandId);
+
+    if (pendingCommandIterator != m_pendingCommands.end())
+    {
+        pendingCommandIterator->sendTime = sendTime;
+    }
+}
+
+std::vector<CYIBitmovinCommandPipeline::PendingCommand>::iterator CYIBitmovinCommandPipeline::FindPendingCommand(uint64_t commandId)
+{
+    std::vector<PendingCommand>::iterator pendingCommandIterator = std::lower_bound(m_pendingCommands.begin(), m_pendingCommands.end(), commandId, [](const PendingCommand &pendingCommand, uint64_t id) {
+        return pendingCommand.commandId < id;
+    });
+
+    if (pendingCommandIterator == m_pendingCommands.end() || pendingCommandIterator->commandId != commandId)
+    {
+        return m_pendingCommands.end();
+    }
+
+    return pendingCommandIterator;
+}
@@ -0,0 +1,128 @@
+#ifndef _YI_BITMOVIN_COMMAND_PIPELINE_H_
+#define _YI_BITMOVIN_COMMAND_PIPELINE_H_
+
+#include "YiBitmovinBridgeScheduler.h"
+#include "YiBitmovinBridgeTransport.h"
+#include "YiBitmovinLatencyRecorder.h"
+
+#include <platform/YiWebMessagingBridge.h>
+#include <signal/YiSignalHandler.h>
+#include <utility/YiRapidJSONUtility.h>
+#include <utility/YiTimer.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
+
+class CYIBitmovinCommandPipeline : public CYISignalHandler
+{
+public:
+    typedef CYIBitmovinBridgeTransport::Target Target;
+
+    struct Result
+    {
+        bool success = false;
+        bool timedOut = false;
+        const yi::rapidjson::Value *pValue = nullptr;
+        CYIString errorMessage;
+    };
+
+    typedef std::function<void(const Result &result)> CompletionCallback;
+    typedef std::function<void(const char *pFunctionName, const Result &result)> FailureCallback;
+
+    // note: the instance ID is added to instance commands sent as part of a command batch, since the batch itself is a static call
+    CYIBitmovinCommandPipeline(const CYIString &className, const CYIString &instanceAccessorName, uint64_t instanceId = 0);
+    virtual ~CYIBitmovinCommandPipeline();
+
+    // note: commands are built in an arena owned by the pipeline which is reset once all queued commands have been sent,
+    // so the returned document must be sent through this pipeline or destroyed within the current update tick
+    yi::rapidjson::Document CreateCommand();
+
+    void SetLatencyRecorder(CYIBitmovinLatencyRecorder *pLatencyRecorder);
+
+    // note: invoked before the completion callback of every failed command sent with reportFailure set, so that callers sharing a failure
+    // handler do not each need to wrap their completion callback
+    void SetFailureCallback(FailureCallback &&failureCallback);
+
+    // note: function names are not copied and must have static storage duration
+    // note: the timeout is only used until enough responses have been observed for the latency recorder to provide an adaptive timeout
+    bool Send(Target target, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, CompletionCallback &&completionCallback = CompletionCallback(), uint64_t timeoutMs = CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, bool reportFailure = false);
+    bool SendLatest(Target target, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments);
+    void Flush();
+    void CancelAll();
+    size_t GetPendingCommandCount() const;
+
+private:
+    struct PendingCommand
+    {
+        uint64_t commandId;
+        const char *pFunctionName;
+        CompletionCallback completionCallback;
+        bool reportFailure;
+        std::chrono::steady_clock::time_point deadline;
+        std::chrono::steady_clock::time_point sendTime;
+    };
+
+    struct CancelledCommand
+    {
+        uint64_t commandId;
+        const char *pFunctionName;
+        std::chrono::steady_clock::time_point sendTime;
+    };
+
+    // note: commands are numbered as they are queued and a batch holds every control command of one flush, so the ids of a batch are
+    // consecutive and the batch is tracked as a range rather than a list of ids
+    struct CommandBatch
+    {
+        uint64_t firstCommandId;
+        size_t commandCount;
+    };
+
+    struct QueuedCommand
+    {
+        uint64_t commandId;
+        Target target;
+        const char *pFunctionName;
+        yi::rapidjson::Document command;
+        yi::rapidjson::Value arguments;
+    };
+
+    void SendQueuedCommand(QueuedCommand &queuedCommand);
+    void SendQueuedCommandBatch(std::vector<QueuedCommand> &queuedCommands, size_t commandCount);
+    void OnResponseReceived(uint64_t commandId, const CYIBitmovinBridgeTransport::Response &response);
+    void OnBatchResponseReceived(uint64_t firstCommandId, const CYIBitmovinBridgeTransport::Response &response);
+    void OnBatchTimerTimedOut();
+    void OnTimeoutTimerTimedOut();
+    void Fail(uint64_t commandId, const CYIString &errorMessage);
+    void Complete(uint64_t commandId, const Result &result);
+    void Cancel(std::vector<PendingCommand>::iterator pendingCommandIterator);
+    bool DropLateResponse(uint64_t commandId);
+    bool IsAwaitingResponse(const CommandBatch &commandBatch);
+    void ScheduleTimeoutTimer();
+    void Enqueue(QueuedCommand &&queuedCommand);
+    void ResetCommandArena();
+    void MarkSent(uint64_t commandId, std::chrono::steady_clock::time_point sendTime);
+    std::vector<PendingCommand>::iterator FindPendingCommand(uint64_t commandId);
+
+    CYIString m_className;
+    CYIString m_instanceAccessorName;
+    uint64_t m_instanceId;
+    uint64_t m_nextCommandId;
+    bool m_flushing;
+    std::vector<QueuedCommand> m_queuedCommands;
+    std::vector<QueuedCommand> m_sendingCommands;
+    std::vector<PendingCommand> m_pendingCommands;
+    std::vector<CancelledCommand> m_cancelledCommands;
+    std::vector<CommandBatch> m_commandBatches;
+    std::vector<uint64_t> m_timedOutCommandIds;
+    std::unique_ptr<char[]> m_pCommandArenaBuffer;
+    size_t m_commandArenaBufferSize;
+    std::unique_ptr<yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator>> m_pCommandArena;
+    CYIBitmovinLatencyRecorder *m_pLatencyRecorder;
+    FailureCallback m_failureCallback;
+    CYITimer m_batchTimer;
+    CYITimer m_timeoutTimer;
+};
+
+#endif // _YI_BITMOVIN_COMMAND_PIPELINE_H_
@@ -0,0 +1,316 @@
+#include "YiBitmovinEventDispatcher.h"
+
+#include "YiBitmovinBridgeTransport.h"
+
+#include <algorithm>
+#include <cstring>
+
+#define LOG_TAG "CYIBitmovinEventDispatcher"
+
+static const size_t INITIAL_TABLE_CAPACITY = 32;
+static const uint32_t FNV_OFFSET_BASIS = 2166136261u;
+static const uint32_t FNV_PRIME = 16777619u;
+static const char *EVENT_INSTANCE_ID_ATTRIBUTE_NAME = "instanceId";
+
+CYIBitmovinEventDispatcher::CYIBitmovinEventDispatcher(const CYIString &contextName, uint64_t instanceId)
+    : m_contextName(contextName)
+    , m_instanceId(instanceId)
+    , m_registered(false)
+    , m_entries(INITIAL_TABLE_CAPACITY)
+    , m_entryCount(0)
+    , m_unhandledEventCount(0)
+{
+}
+
+CYIBitmovinEventDispatcher::~CYIBitmovinEventDispatcher()
+{
+    Unregister();
+}
+
+void CYIBitmovinEventDispatcher::AddHandler(const char *pEventName, EventHandler &&eventHandler)
+{
+    size_t eventNameLength = std::strlen(pEventName);
+    uint32_t hash = HashEventName(pEventName, eventNameLength);
+
+    Entry *pEntry = Find(hash, pEventName, eventNameLength);
+
+    if (pEntry && pEntry->pEventName)
+    {
+        YI_LOGW(LOG_TAG, "Replacing existing handler for %s event.", pEventName);
+
+        pEntry->eventHandler = std::move(eventHandler);
+        return;
+    }
+
+    // the table is kept at most half full so that lookups rarely need to probe more than one slot
+    if ((m_entryCount + 1) * 2 > m_entries.size())
+    {
+        Rehash(m_entries.size() * 2);
+        pEntry = Find(hash, pEventName, eventNameLength);
+    }
+
+    pEntry->hash = hash;
+    pEntry->pEventName = pEventName;
+    pEntry->eventNameLength = eventNameLength;
+    pEntry->eventHandler = std::move(eventHandler);
+    pEntry->dispatchCount = 0;
+
+    m_entryCount++;
+}
+
+bool CYIBitmovinEventDispatcher::Register()
+{
+    if (m_registered)
+    {
+        return true;
+    }
+
+    Context &context = GetContexts()[m_contextName];
+
+    // a single handler for the event context is registered, the instance and event name are resolved by the dispatchers instead
+    if (context.eventHandlerId == 0)
+    {
+        CYIString contextName(m_contextName);
+
+        context.eventHandlerId = CYIBitmovinBridgeTransport::GetInstance()->RegisterEventHandler(m_contextName, [contextName](const yi::rapidjson::Value &eventValue) {
+            OnContextEventReceived(contextName, eventValue);
+        });
+
+        if (context.eventHandlerId == 0)
+        {
+            GetContexts().erase(m_contextName);
+            return false;
+        }
+    }
+
+    context.dispatchers.push_back(this);
+    m_registered = true;
+
+    return true;
+}
+
+void CYIBitmovinEventDispatcher::Unregister()
+{
+    if (!m_registered)
+    {
+        return;
+    }
+
+    m_registered = false;
+
+    std::map<CYIString, Context> &contexts = GetContexts();
+    std::map<CYIString, Context>::iterator contextIterator = contexts.find(m_contextName);
+
+    if (contextIterator == contexts.end())
+    {
+        return;
+    }
+
+    std::vector<CYIBitmovinEventDispatcher *> &dispatchers = contextIterator->second.dispatchers;
+    dispatchers.erase(std::remove(dispatchers.begin(), dispatchers.end(), this), dispatchers.end());
+
+    if (dispatchers.empty())
+    {
+        CYIBitmovinBridgeTransport::GetInstance()->UnregisterEventHandler(contextIterator->second.eventHandlerId);
+
+        contexts.erase(contextIterator);
+    }
+}
+
+bool CYIBitmovinEventDispatcher::IsRegistered() const
+{
+    return m_registered;
+}
+
+std::map<CYIString, uint64_t> CYIBitmovinEventDispatcher::GetDispatchCounts() const
+{
+    std::map<CYIString, uint64_t> dispatchCounts;
+
+    for (const Entry &entry : m_entries)
+    {
+        if (entry.pEventName)
+        {
+            dispatchCounts[entry.pEventName] = entry.dispatchCount;
+        }
+    }
+
+    return dispatchCounts;
+}
+
+uint64_t CYIBitmovinEventDispatcher::GetUnhandledEventCount() const
+{
+    return m_unhandledEventCount;
+}
+
+void CYIBitmovinEventDispatcher::OnEventReceived(const yi::rapidjson::Value &eventValue)
+{
+    if (!eventValue.IsObject())
+    {
+        YI_LOGE(LOG_TAG, "OnEventReceived encountered an invalid event value, expected object, received %s. JSON string for event: %s", CYIRapidJSONUtility::TypeToString(eventValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        return;
+    }
+
+    yi::rapidjson::Value::ConstMemberIterator eventNameIterator = eventValue.FindMember(CYIWebMessagingBridge::EVENT_NAME_ATTRIBUTE_NAME);
+
+    if (eventNameIterator == eventValue.MemberEnd() || !eventNameIterator->value.IsString())
+    {
+        YI_LOGE(LOG_TAG, "OnEventReceived event value is missing a valid '%s' attribute! JSON string for event: %s", CYIWebMessagingBridge::EVENT_NAME_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        return;
+    }
+
+    const char *pEventName = eventNameIterator->value.GetString();
+    size_t eventNameLength = eventNameIterator->value.GetStringLength();
+
+    Entry *pEntry = Find(HashEventName(pEventName, eventNameLength), pEventName, eventNameLength);
+
+    if (!pEntry || !pEntry->pEventName)
+    {
+        m_unhandledEventCount++;
+        return;
+    }
+
+    pEntry->dispatchCount++;
+    pEntry->eventHandler(eventValue);
+}
+
+bool CYIBitmovinEventDispatcher::AcceptsInstance(uint64_t instanceId) const
+{
+    return m_instanceId == 0 || m_instanceId == instanceId;
+}
+
+void CYIBitmovinEventDispatcher::OnContextEventReceived(const CYIString &contextName, const yi::rapidjson::Value &eventValue)
+{
+    std::map<CYIString, Context> &contexts = GetContexts();
+    std::map<CYIString, Context>::iterator contextIterator = contexts.find(contextName);
+
+    if (contextIterator == contexts.end())
+    {
+        return;
+    }
+
+    bool routed = false;
+    uint64_t instanceId = 0;
+
+    if (eventValue.IsObject())
+    {
+        yi::rapidjson::Value::ConstMemberIterator instanceIdIterator = eventValue.FindMember(EVENT_INSTANCE_ID_ATTRIBUTE_NAME);
+
+        if (instanceIdIterator != eventValue.MemberEnd())
+        {
+            // events from a JS player which no native player has attached to yet have a null instance ID and belong to nobody
+            if (!instanceIdIterator->value.IsUint64())
+            {
+                return;
+            }
+
+            routed = true;
+            instanceId = instanceIdIterator->value.GetUint64();
+        }
+    }
+
+    std::vector<CYIBitmovinEventDispatcher *> &dispatchers = contextIterator->second.dispatchers;
+
+    // with a single player there is nothing to route, and no handler can run before the event has been dispatched
+    if (dispatchers.size() == 1)
+    {
+        if (!routed || dispatchers.front()->AcceptsInstance(instanceId))
+        {
+            dispatchers.front()->OnEventReceived(eventValue);
+        }
+
+        return;
+    }
+
+    // an event handler may destroy any of the other players, so the dispatchers are copied and each one is checked before it is used
+    std::vector<CYIBitmovinEventDispatcher *> dispatchersToNotify(dispatchers);
+
+    for (CYIBitmovinEventDispatcher *pDispatcher : dispatchersToNotify)
+    {
+        if (routed && !pDispatcher->AcceptsInstance(instanceId))
+        {
+            continue;
+        }
+
+        if (!IsDispatcherRegistered(contextName, pDispatcher))
+        {
+            continue;
+        }
+
+        pDispatcher->OnEventReceived(eventValue);
+    }
+}
+
+bool CYIBitmovinEventDispatcher::IsDispatcherRegistered(const CYIString &contextName, const CYIBitmovinEventDispatcher *pDispatcher)
+{
+    std::map<CYIString, Context> &contexts = GetContexts();
+    std::map<CYIString, Context>::const_iterator contextIterator = contexts.find(contextName);
+
+    if (contextIterator == contexts.end())
+    {
+        return false;
+    }
+
+    const std::vector<CYIBitmovinEventDispatcher *> &dispatchers = contextIterator->second.dispatchers;
+
+    return std::find(dispatchers.begin(), dispatchers.end(), pDispatcher) != dispatchers.end();
+}
+
+std::map<CYIString, CYIBitmovinEventDispatcher::Context> &CYIBitmovinEventDispatcher::GetContexts()
+{
+    static std::map<CYIString, Context> contexts;
+
+    return contexts;
+}
+
+void CYIBitmovinEventDispatcher::Rehash(size_t capacity)
+{
+    std::vector<Entry> entries(capacity);
+    entries.swap(m_entries);
+
+    for (Entry &entry : entries)
+    {
+        if (!entry.pEventName)
+        {
+            continue;
+        }
+
+        Entry *pEntry = Find(entry.hash, entry.pEventName, entry.eventNameLength);
+        *pEntry = std::move(entry);
+    }
+}
+
+CYIBitmovinEventDispatcher::Entry *CYIBitmovinEventDispatcher::Find(uint32_t hash, const char *pEventName, size_t eventNameLength)
+{
+    // the table capacity is always a power of two, so the hash can be masked into an index and probed linearly
+    size_t mask = m_entries.size() - 1;
+
+    for (size_t i = 0; i < m_entries.size(); i++)
+    {
+        Entry &entry = m_entries[(hash + i) & mask];
+
+        if (!entry.pEventName)
+        {
+            return &entry;
+        }
+
+        if (entry.hash == hash && entry.eventNameLength == eventNameLength && std::memcmp(entry.pEventName, pEventName, eventNameLength) == 0)
+        {
+            return &entry;
+        }
+    }
+
+    return nullptr;
+}
+
+uint32_t CYIBitmovinEventDispatcher::HashEventName(const char *pEventName, size_t eventNameLength)
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+
+    for (size_t i = 0; i < eventNameLength; i++)
+    {
+        hash ^= static_cast<uint8_t>(pEventName[i]);
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
@@ -0,0 +1,63 @@
+#ifndef _YI_BITMOVIN_EVENT_DISPATCHER_H_
+#define _YI_BITMOVIN_EVENT_DISPATCHER_H_
+
+#include <platform/YiWebMessagingBridge.h>
+#include <utility/YiRapidJSONUtility.h>
+
+#include <functional>
+#include <map>
+#include <vector>
+
+class CYIBitmovinEventDispatcher
+{
+public:
+    typedef std::function<void(const yi::rapidjson::Value &eventValue)> EventHandler;
+
+    // note: dispatchers for the same context share a single transport event handler. Events which carry an instance ID are only
+    // dispatched to the dispatcher for that instance, events without one are dispatched to every dispatcher for the context, and a
+    // dispatcher with an instance ID of zero receives all events for its context.
+    CYIBitmovinEventDispatcher(const CYIString &contextName, uint64_t instanceId = 0);
+    ~CYIBitmovinEventDispatcher();
+
+    // note: event names are not copied and must have static storage duration
+    void AddHandler(const char *pEventName, EventHandler &&eventHandler);
+    bool Register();
+    void Unregister();
+    bool IsRegistered() const;
+    std::map<CYIString, uint64_t> GetDispatchCounts() const;
+    uint64_t GetUnhandledEventCount() const;
+
+private:
+    struct Context
+    {
+        uint64_t eventHandlerId = 0;
+        std::vector<CYIBitmovinEventDispatcher *> dispatchers;
+    };
+
+    struct Entry
+    {
+        uint32_t hash = 0;
+        const char *pEventName = nullptr;
+        size_t eventNameLength = 0;
+        EventHandler eventHandler;
+        uint64_t dispatchCount = 0;
+    };
+
+    void OnEventReceived(const yi::rapidjson::Value &eventValue);
+    bool AcceptsInstance(uint64_t instanceId) const;
+    static void OnContextEventReceived(const CYIString &contextName, const yi::rapidjson::Value &eventValue);
+    static bool IsDispatcherRegistered(const CYIString &contextName, const CYIBitmovinEventDispatcher *pDispatcher);
+    static std::map<CYIString, Context> &GetContexts();
+    void Rehash(size_t capacity);
+    Entry *Find(uint32_t hash, const char *pEventName, size_t eventNameLength);
+    static uint32_t HashEventName(const char *pEventName, size_t eventNameLength);
+
+    CYIString m_contextName;
+    uint64_t m_instanceId;
+    bool m_registered;
+    std::vector<Entry> m_entries;
+    size_t m_entryCount;
+    uint64_t m_unhandledEventCount;
+};
+
+#endif // _YI_BITMOVIN_EVENT_DISPATCHER_H_
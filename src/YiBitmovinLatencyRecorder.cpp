@@ -0,0 +1,185 @@
+#include "YiBitmovinLatencyRecorder.h"
+
+#include <logging/YiLogger.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+#define LOG_TAG "CYIBitmovinLatencyRecorder"
+
+void CYIBitmovinLatencyRecorder::SetTimeoutPolicy(const TimeoutPolicy &timeoutPolicy)
+{
+    m_timeoutPolicy = timeoutPolicy;
+    m_timeoutPolicy.maximumTimeoutMs = std::max(m_timeoutPolicy.maximumTimeoutMs, m_timeoutPolicy.minimumTimeoutMs);
+}
+
+const CYIBitmovinLatencyRecorder::TimeoutPolicy &CYIBitmovinLatencyRecorder::GetTimeoutPolicy() const
+{
+    return m_timeoutPolicy;
+}
+
+uint64_t CYIBitmovinLatencyRecorder::GetTimeoutMs(const char *pFunctionName, uint64_t defaultTimeoutMs) const
+{
+    std::map<const char *, Histogram, FunctionNameLess>::const_iterator histogramIterator = m_histograms.find(pFunctionName);
+
+    // the default timeout is used until enough responses have been observed for the p99 to be meaningful
+    if (histogramIterator == m_histograms.end() || histogramIterator->second.count < m_timeoutPolicy.minimumSampleCount)
+    {
+        return defaultTimeoutMs;
+    }
+
+    double timeoutUs = GetPercentileUs(histogramIterator->second, 0.99) * static_cast<double>(m_timeoutPolicy.p99Multiplier);
+    uint64_t timeoutMs = static_cast<uint64_t>(std::ceil(timeoutUs / 1000.0));
+
+    return std::min(std::max(timeoutMs, m_timeoutPolicy.minimumTimeoutMs), m_timeoutPolicy.maximumTimeoutMs);
+}
+
+void CYIBitmovinLatencyRecorder::RecordLatency(const char *pFunctionName, std::chrono::steady_clock::duration latency)
+{
+    int64_t latencyUs = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    uint64_t valueUs = static_cast<uint64_t>(std::max<int64_t>(latencyUs, 0));
+
+    Histogram &histogram = m_histograms[pFunctionName];
+
+    histogram.bucketCounts[GetBucketIndex(valueUs)]++;
+    histogram.minUs = histogram.count == 0 ? valueUs : std::min(histogram.minUs, valueUs);
+    histogram.maxUs = std::max(histogram.maxUs, valueUs);
+    histogram.totalUs += valueUs;
+    histogram.count++;
+}
+
+void CYIBitmovinLatencyRecorder::RecordError(const char *pFunctionName)
+{
+    m_histograms[pFunctionName].errorCount++;
+}
+
+void CYIBitmovinLatencyRecorder::RecordTimeout(const char *pFunctionName)
+{
+    m_histograms[pFunctionName].timeoutCount++;
+}
+
+uint64_t CYIBitmovinLatencyRecorder::GetSampleCount(const char *pFunctionName) const
+{
+    std::map<const char *, Histogram, FunctionNameLess>::const_iterator histogramIterator = m_histograms.find(pFunctionName);
+
+    return histogramIterator == m_histograms.end() ? 0 : histogramIterator->second.count;
+}
+
+uint64_t CYIBitmovinLatencyRecorder::GetPercentileUs(const char *pFunctionName, double percentile) const
+{
+    std::map<const char *, Histogram, FunctionNameLess>::const_iterator histogramIterator = m_histograms.find(pFunctionName);
+
+    return histogramIterator == m_histograms.end() ? 0 : GetPercentileUs(histogramIterator->second, percentile);
+}
+
+std::vector<CYIBitmovinLatencyRecorder::Summary> CYIBitmovinLatencyRecorder::GetSummaries() const
+{
+    std::vector<Summary> summaries;
+    summaries.reserve(m_histograms.size());
+
+    for (const std::pair<const char *const, Histogram> &histogramEntry : m_histograms)
+    {
+        const Histogram &histogram = histogramEntry.second;
+
+        Summary summary;
+        summary.functionName = histogramEntry.first;
+        summary.count = histogram.count;
+        summary.errorCount = histogram.errorCount;
+        summary.timeoutCount = histogram.timeoutCount;
+        summary.minUs = histogram.minUs;
+        summary.meanUs = histogram.count == 0 ? 0 : histogram.totalUs / histogram.count;
+        summary.p50Us = GetPercentileUs(histogram, 0.5);
+        summary.p90Us = GetPercentileUs(histogram, 0.9);
+        summary.p99Us = GetPercentileUs(histogram, 0.99);
+        summary.maxUs = histogram.maxUs;
+
+        summaries.push_back(summary);
+    }
+
+    return summaries;
+}
+
+bool CYIBitmovinLatencyRecorder::DumpToFile(const CYIString &filePath) const
+{
+    std::ofstream dumpFile(filePath.GetData(), std::ios::out | std::ios::trunc);
+
+    if (!dumpFile.is_open())
+    {
+        YI_LOGW(LOG_TAG, "Failed to write latency dump file: %s", filePath.GetData());
+        return false;
+    }
+
+    dumpFile << "function,count,errors,timeouts,min_us,mean_us,p50_us,p90_us,p99_us,max_us\n";
+
+    for (const Summary &summary : GetSummaries())
+    {
+        dumpFile << summary.functionName.GetData() << ',' << summary.count << ',' << summary.errorCount << ',' << summary.timeoutCount << ',' << summary.minUs << ',' << summary.meanUs << ',' << summary.p50Us << ',' << summary.p90Us << ',' << summary.p99Us << ',' << summary.maxUs << '\n';
+    }
+
+    return dumpFile.good();
+}
+
+void CYIBitmovinLatencyRecorder::Reset()
+{
+    m_histograms.clear();
+}
+
+bool CYIBitmovinLatencyRecorder::FunctionNameLess::operator()(const char *pLeft, const char *pRight) const
+{
+    return std::strcmp(pLeft, pRight) < 0;
+}
+
+size_t CYIBitmovinLatencyRecorder::GetBucketIndex(uint64_t valueUs)
+{
+    valueUs = std::min<uint64_t>(valueUs, (1ULL << MAX_VALUE_BITS) - 1);
+
+    // values below two sub-bucket ranges are recorded exactly, larger values keep their top SUB_BUCKET_BITS + 1 significant bits
+    if (valueUs < 2 * SUB_BUCKET_COUNT)
+    {
+        return static_cast<size_t>(valueUs);
+    }
+
+    uint32_t mostSignificantBit = 63 - static_cast<uint32_t>(__builtin_clzll(valueUs));
+    uint32_t shift = mostSignificantBit - SUB_BUCKET_BITS;
+    uint64_t subBucket = (valueUs >> shift) - SUB_BUCKET_COUNT;
+
+    return 2 * SUB_BUCKET_COUNT + (shift - 1) * SUB_BUCKET_COUNT + static_cast<size_t>(subBucket);
+}
+
+uint64_t CYIBitmovinLatencyRecorder::GetBucketUpperBoundUs(size_t bucketIndex)
+{
+    if (bucketIndex < 2 * SUB_BUCKET_COUNT)
+    {
+        return bucketIndex;
+    }
+
+    uint32_t shift = static_cast<uint32_t>((bucketIndex - 2 * SUB_BUCKET_COUNT) / SUB_BUCKET_COUNT) + 1;
+    uint64_t subBucket = (bucketIndex - 2 * SUB_BUCKET_COUNT) % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+
+    return ((subBucket + 1) << shift) - 1;
+}
+
+uint64_t CYIBitmovinLatencyRecorder::GetPercentileUs(const Histogram &histogram, double percentile)
+{
+    if (histogram.count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t targetCount = std::max<uint64_t>(static_cast<uint64_t>(std::ceil(percentile * histogram.count)), 1);
+    uint64_t cumulativeCount = 0;
+
+    for (size_t i = 0; i < BUCKET_COUNT; i++)
+    {
+        cumulativeCount += histogram.bucketCounts[i];
+
+        if (cumulativeCount >= targetCount)
+        {
+            return std::min(GetBucketUpperBoundUs(i), histogram.maxUs);
+        }
+    }
+
+    return histogram.maxUs;
+}
@@ -0,0 +1,85 @@
+#ifndef _YI_BITMOVIN_LATENCY_RECORDER_H_
+#define _YI_BITMOVIN_LATENCY_RECORDER_H_
+
+#include <utility/YiString.h>
+
+#include <array>
+#include <chrono>
+#include <map>
+#include <vector>
+
+class CYIBitmovinLatencyRecorder
+{
+public:
+    struct Summary
+    {
+        CYIString functionName;
+        uint64_t count = 0;
+        uint64_t errorCount = 0;
+        uint64_t timeoutCount = 0;
+        uint64_t minUs = 0;
+        uint64_t meanUs = 0;
+        uint64_t p50Us = 0;
+        uint64_t p90Us = 0;
+        uint64_t p99Us = 0;
+        uint64_t maxUs = 0;
+    };
+
+    struct TimeoutPolicy
+    {
+        float p99Multiplier = 3.0f;
+        uint64_t minimumTimeoutMs = 250;
+        uint64_t maximumTimeoutMs = 15000;
+        uint64_t minimumSampleCount = 20;
+    };
+
+    CYIBitmovinLatencyRecorder() = default;
+
+    void SetTimeoutPolicy(const TimeoutPolicy &timeoutPolicy);
+    const TimeoutPolicy &GetTimeoutPolicy() const;
+
+    // note: function names are not copied and must have static storage duration, histograms are looked up by comparing the names so that
+    // recording a response does not allocate once its function has been seen
+    uint64_t GetTimeoutMs(const char *pFunctionName, uint64_t defaultTimeoutMs) const;
+    void RecordLatency(const char *pFunctionName, std::chrono::steady_clock::duration latency);
+    void RecordError(const char *pFunctionName);
+    void RecordTimeout(const char *pFunctionName);
+    uint64_t GetSampleCount(const char *pFunctionName) const;
+    uint64_t GetPercentileUs(const char *pFunctionName, double percentile) const;
+
+    std::vector<Summary> GetSummaries() const;
+    bool DumpToFile(const CYIString &filePath) const;
+    void Reset();
+
+private:
+    // values are bucketed with 16 linear sub-buckets per power of two, which bounds the relative error of any percentile to ~6%
+    static const uint32_t SUB_BUCKET_BITS = 4;
+    static const uint32_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+    static const uint32_t MAX_VALUE_BITS = 36;
+    static const size_t BUCKET_COUNT = 2 * SUB_BUCKET_COUNT + (MAX_VALUE_BITS - SUB_BUCKET_BITS - 1) * SUB_BUCKET_COUNT;
+
+    struct Histogram
+    {
+        std::array<uint32_t, BUCKET_COUNT> bucketCounts{};
+        uint64_t count = 0;
+        uint64_t errorCount = 0;
+        uint64_t timeoutCount = 0;
+        uint64_t minUs = 0;
+        uint64_t maxUs = 0;
+        uint64_t totalUs = 0;
+    };
+
+    struct FunctionNameLess
+    {
+        bool operator()(const char *pLeft, const char *pRight) const;
+    };
+
+    static size_t GetBucketIndex(uint64_t valueUs);
+    static uint64_t GetBucketUpperBoundUs(size_t bucketIndex);
+    static uint64_t GetPercentileUs(const Histogram &histogram, double percentile);
+
+    TimeoutPolicy m_timeoutPolicy;
+    std::map<const char *, Histogram, FunctionNameLess> m_histograms;
+};
+
+#endif // _YI_BITMOVIN_LATENCY_RECORDER_H_
@@ -0,0 +1,150 @@
+#include "YiBitmovinLogRingBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+static size_t RoundUpToPowerOfTwo(size_t value)
+{
+    size_t powerOfTwo = 1;
+
+    while (powerOfTwo < value)
+    {
+        powerOfTwo <<= 1;
+    }
+
+    return powerOfTwo;
+}
+
+CYIBitmovinLogRingBuffer::CYIBitmovinLogRingBuffer(size_t capacity, size_t maximumMessageLength)
+    : m_capacity(RoundUpToPowerOfTwo(std::max<size_t>(capacity, 2)))
+    , m_maximumMessageLength(std::max<size_t>(maximumMessageLength, 1))
+    , m_enqueuePosition(0)
+    , m_dequeuePosition(0)
+    , m_droppedMessageCount(0)
+    , m_truncatedMessageCount(0)
+{
+    m_pSlots.reset(new Slot[m_capacity]);
+    m_pMessageBuffer.reset(new char[m_capacity * m_maximumMessageLength]);
+
+    // each slot's sequence is its position while it is free and one past its position once it holds a message, which lets producers
+    // claim slots and the consumer detect completed ones without a lock
+    for (size_t i = 0; i < m_capacity; i++)
+    {
+        m_pSlots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+CYIBitmovinLogRingBuffer::~CYIBitmovinLogRingBuffer()
+{
+}
+
+bool CYIBitmovinLogRingBuffer::Push(const char *pClassName, const char *pBatchFunctionName, const char *pLevel, const char *pMessage, size_t messageLength)
+{
+    size_t mask = m_capacity - 1;
+    size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+    Slot *pSlot = nullptr;
+
+    while (true)
+    {
+        pSlot = &m_pSlots[position & mask];
+
+        size_t sequence = pSlot->sequence.load(std::memory_order_acquire);
+        intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+        if (difference == 0)
+        {
+            if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            // the consumer has not released this slot yet, so the buffer is full
+            m_droppedMessageCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            position = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    if (messageLength > m_maximumMessageLength)
+    {
+        messageLength = m_maximumMessageLength;
+
+        // the message is cut at a character boundary, so that a multi-byte UTF-8 sequence is never split
+        while (messageLength > 0 && (static_cast<unsigned char>(pMessage[messageLength]) & 0xC0) == 0x80)
+        {
+            messageLength--;
+        }
+
+        m_truncatedMessageCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    char *pSlotMessage = &m_pMessageBuffer[(position & mask) * m_maximumMessageLength];
+    std::memcpy(pSlotMessage, pMessage, messageLength);
+
+    pSlot->entry.pClassName = pClassName;
+    pSlot->entry.pBatchFunctionName = pBatchFunctionName;
+    pSlot->entry.pLevel = pLevel;
+    pSlot->entry.pMessage = pSlotMessage;
+    pSlot->entry.messageLength = messageLength;
+
+    pSlot->sequence.store(position + 1, std::memory_order_release);
+
+    return true;
+}
+
+size_t CYIBitmovinLogRingBuffer::Pop(size_t maximumCount, const EntryHandler &entryHandler)
+{
+    size_t mask = m_capacity - 1;
+    size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+    size_t poppedCount = 0;
+
+    while (poppedCount < maximumCount)
+    {
+        Slot &slot = m_pSlots[position & mask];
+
+        // a slot which has been claimed but not yet written stops the drain, messages are always delivered in order
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1)
+        {
+            break;
+        }
+
+        entryHandler(slot.entry);
+
+        slot.sequence.store(position + m_capacity, std::memory_order_release);
+
+        position++;
+        poppedCount++;
+    }
+
+    m_dequeuePosition.store(position, std::memory_order_relaxed);
+
+    return poppedCount;
+}
+
+size_t CYIBitmovinLogRingBuffer::GetSize() const
+{
+    size_t enqueuePosition = m_enqueuePosition.load(std::memory_order_relaxed);
+    size_t dequeuePosition = m_dequeuePosition.load(std::memory_order_relaxed);
+
+    return enqueuePosition > dequeuePosition ? enqueuePosition - dequeuePosition : 0;
+}
+
+size_t CYIBitmovinLogRingBuffer::GetCapacity() const
+{
+    return m_capacity;
+}
+
+uint64_t CYIBitmovinLogRingBuffer::GetDroppedMessageCount() const
+{
+    return m_droppedMessageCount.load(std::memory_order_relaxed);
+}
+
+uint64_t CYIBitmovinLogRingBuffer::GetTruncatedMessageCount() const
+{
+    return m_truncatedMessageCount.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,64 @@
+#ifndef _YI_BITMOVIN_LOG_RING_BUFFER_H_
+#define _YI_BITMOVIN_LOG_RING_BUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+// note: a bounded multiple producer, single consumer queue of log messages which never blocks or allocates once constructed. Each slot
+// holds a copy of the message text of up to the maximum message length, longer messages are truncated. A message pushed while the
+// buffer is full is dropped rather than displacing an older one, since a slot cannot be reclaimed from the consumer without a lock.
+//
+// note: class names, batch function names and levels are not copied and must have static storage duration
+class CYIBitmovinLogRingBuffer
+{
+public:
+    struct Entry
+    {
+        const char *pClassName = nullptr;
+        const char *pBatchFunctionName = nullptr;
+        const char *pLevel = nullptr;
+        const char *pMessage = nullptr;
+        size_t messageLength = 0;
+    };
+
+    typedef std::function<void(const Entry &entry)> EntryHandler;
+
+    // note: the capacity is rounded up to a power of two
+    CYIBitmovinLogRingBuffer(size_t capacity, size_t maximumMessageLength);
+    ~CYIBitmovinLogRingBuffer();
+
+    // note: may be called from any thread, returns false if the buffer is full and the message was dropped
+    bool Push(const char *pClassName, const char *pBatchFunctionName, const char *pLevel, const char *pMessage, size_t messageLength);
+
+    // note: must only be called from the consumer thread, entries are only valid for the duration of the entry handler
+    size_t Pop(size_t maximumCount, const EntryHandler &entryHandler);
+
+    // note: approximate while messages are being pushed
+    size_t GetSize() const;
+    size_t GetCapacity() const;
+    uint64_t GetDroppedMessageCount() const;
+    uint64_t GetTruncatedMessageCount() const;
+
+private:
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        Entry entry;
+    };
+
+    std::unique_ptr<Slot[]> m_pSlots;
+    std::unique_ptr<char[]> m_pMessageBuffer;
+    size_t m_capacity;
+    size_t m_maximumMessageLength;
+
+    // note: kept on separate cache lines, since the producers and the consumer update them independently
+    alignas(64) std::atomic<size_t> m_enqueuePosition;
+    alignas(64) std::atomic<size_t> m_dequeuePosition;
+    alignas(64) std::atomic<uint64_t> m_droppedMessageCount;
+    std::atomic<uint64_t> m_truncatedMessageCount;
+};
+
+#endif // _YI_BITMOVIN_LOG_RING_BUFFER_H_
@@ -0,0 +1,131 @@
+#include "YiBitmovinPlayheadClock.h"
+
+#include <algorithm>
+#include <cmath>
+
+static const double DEFAULT_SNAP_THRESHOLD_MS = 1000.0;
+static const double DEFAULT_CORRECTION_WINDOW_MS = 500.0;
+
+static double ToMilliseconds(std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+CYIBitmovinPlayheadClock::CYIBitmovinPlayheadClock()
+    : m_anchorPositionMs(0.0)
+    , m_anchorTime(std::chrono::steady_clock::now())
+    , m_correctionRate(0.0)
+    , m_correctionEndTime(m_anchorTime)
+    , m_running(false)
+    , m_durationMs(0)
+    , m_lastDriftMs(0)
+    , m_snapThresholdMs(DEFAULT_SNAP_THRESHOLD_MS)
+    , m_correctionWindowMs(DEFAULT_CORRECTION_WINDOW_MS)
+    , m_lastPositionMs(0)
+{
+}
+
+void CYIBitmovinPlayheadClock::SetDriftCorrection(std::chrono::milliseconds snapThreshold, std::chrono::milliseconds correctionWindow)
+{
+    m_snapThresholdMs = static_cast<double>(std::max<std::chrono::milliseconds::rep>(snapThreshold.count(), 0));
+    m_correctionWindowMs = static_cast<double>(std::max<std::chrono::milliseconds::rep>(correctionWindow.count(), 0));
+}
+
+void CYIBitmovinPlayheadClock::Reset(uint64_t positionMs, std::chrono::steady_clock::time_point now)
+{
+    m_anchorPositionMs = static_cast<double>(positionMs);
+    m_anchorTime = now;
+    m_correctionRate = 0.0;
+    m_correctionEndTime = now;
+    m_lastDriftMs = 0;
+    m_lastPositionMs = positionMs;
+}
+
+void CYIBitmovinPlayheadClock::AddSample(uint64_t positionMs, std::chrono::steady_clock::time_point now)
+{
+    double extrapolatedPositionMs = Extrapolate(now);
+    double driftMs = static_cast<double>(positionMs) - extrapolatedPositionMs;
+
+    m_lastDriftMs = static_cast<int64_t>(std::lround(driftMs));
+
+    // while stopped there is nothing to slew, and large errors come from discontinuities such as seeks which should be visible immediately
+    if (!m_running || std::abs(driftMs) >= m_snapThresholdMs || m_correctionWindowMs <= 0.0)
+    {
+        m_anchorPositionMs = static_cast<double>(positionMs);
+        m_anchorTime = now;
+        m_correctionRate = 0.0;
+        m_correctionEndTime = now;
+        m_lastPositionMs = positionMs;
+        return;
+    }
+
+    // the playhead keeps advancing from where it is, at a rate adjusted so that the error is gone by the end of the correction window,
+    // but never so slowly that it would move backwards
+    m_anchorPositionMs = extrapolatedPositionMs;
+    m_anchorTime = now;
+    m_correctionRate = std::max(driftMs / m_correctionWindowMs, -1.0);
+    m_correctionEndTime = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double, std::milli>(m_correctionWindowMs));
+}
+
+void CYIBitmovinPlayheadClock::SetRunning(bool running, std::chrono::steady_clock::time_point now)
+{
+    if (running == m_running)
+    {
+        return;
+    }
+
+    Rebase(now);
+
+    // a pending correction is dropped when the playhead stops, the next sample anchors it exactly
+    m_correctionRate = 0.0;
+    m_correctionEndTime = now;
+    m_running = running;
+}
+
+bool CYIBitmovinPlayheadClock::IsRunning() const
+{
+    return m_running;
+}
+
+void CYIBitmovinPlayheadClock::SetDurationMs(uint64_t durationMs)
+{
+    m_durationMs = durationMs;
+}
+
+uint64_t CYIBitmovinPlayheadClock::GetPositionMs(std::chrono::steady_clock::time_point now) const
+{
+    double positionMs = std::max(Extrapolate(now), 0.0);
+
+    if (m_durationMs > 0)
+    {
+        positionMs = std::min(positionMs, static_cast<double>(m_durationMs));
+    }
+
+    m_lastPositionMs = std::max(m_lastPositionMs, static_cast<uint64_t>(positionMs));
+
+    return m_lastPositionMs;
+}
+
+int64_t CYIBitmovinPlayheadClock::GetLastDriftMs() const
+{
+    return m_lastDriftMs;
+}
+
+double CYIBitmovinPlayheadClock::Extrapolate(std::chrono::steady_clock::time_point now) const
+{
+    if (!m_running || now <= m_anchorTime)
+    {
+        return m_anchorPositionMs;
+    }
+
+    double elapsedMs = ToMilliseconds(now - m_anchorTime);
+    double correctionElapsedMs = m_correctionEndTime > m_anchorTime ? ToMilliseconds(std::min(now, m_correctionEndTime) - m_anchorTime) : 0.0;
+
+    return m_anchorPositionMs + elapsedMs + correctionElapsedMs * m_correctionRate;
+}
+
+void CYIBitmovinPlayheadClock::Rebase(std::chrono::steady_clock::time_point now)
+{
+    m_anchorPositionMs = Extrapolate(now);
+    m_anchorTime = now;
+}
@@ -0,0 +1,45 @@
+#ifndef _YI_BITMOVIN_PLAYHEAD_CLOCK_H_
+#define _YI_BITMOVIN_PLAYHEAD_CLOCK_H_
+
+#include <chrono>
+#include <cstdint>
+
+// note: extrapolates the playhead between the position samples reported by the JS player, so that the current time advances smoothly
+// rather than in steps of the time update interval. Small errors between the extrapolated position and a new sample are slewed out
+// over a short correction window instead of being applied as a jump, and the position never moves backwards unless it is reset.
+class CYIBitmovinPlayheadClock
+{
+public:
+    CYIBitmovinPlayheadClock();
+
+    // note: errors at or above the snap threshold are applied immediately, smaller ones are corrected over the correction window
+    void SetDriftCorrection(std::chrono::milliseconds snapThreshold, std::chrono::milliseconds correctionWindow);
+
+    void Reset(uint64_t positionMs, std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+    void AddSample(uint64_t positionMs, std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+    void SetRunning(bool running, std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+    bool IsRunning() const;
+
+    // note: the extrapolated position is clamped to the duration, a duration of zero leaves it unbounded
+    void SetDurationMs(uint64_t durationMs);
+
+    uint64_t GetPositionMs(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now()) const;
+    int64_t GetLastDriftMs() const;
+
+private:
+    double Extrapolate(std::chrono::steady_clock::time_point now) const;
+    void Rebase(std::chrono::steady_clock::time_point now);
+
+    double m_anchorPositionMs;
+    std::chrono::steady_clock::time_point m_anchorTime;
+    double m_correctionRate;
+    std::chrono::steady_clock::time_point m_correctionEndTime;
+    bool m_running;
+    uint64_t m_durationMs;
+    int64_t m_lastDriftMs;
+    double m_snapThresholdMs;
+    double m_correctionWindowMs;
+    mutable uint64_t m_lastPositionMs;
+};
+
+#endif // _YI_BITMOVIN_PLAYHEAD_CLOCK_H_
@@ -0,0 +1,240 @@
+#include "YiBitmovinQoEMetrics.h"
+
+static uint64_t ToMicroseconds(std::chrono::steady_clock::duration duration)
+{
+    // the clock is monotonic, but callers may pass time points slightly out of order
+    if (duration.count() <= 0)
+    {
+        return 0;
+    }
+
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+}
+
+CYIBitmovinQoEMetrics::CYIBitmovinQoEMetrics()
+{
+    Reset();
+}
+
+void CYIBitmovinQoEMetrics::StartSession(std::chrono::steady_clock::time_point now)
+{
+    Reset();
+
+    m_sessionStarted = true;
+    m_sessionStartTime = now;
+    m_lastUpdateTime = now;
+}
+
+void CYIBitmovinQoEMetrics::Reset()
+{
+    m_sessionStarted = false;
+    m_startupComplete = false;
+    m_playing = false;
+    m_buffering = false;
+    m_seeking = false;
+    m_videoBitrateKbps = -1.0f;
+    m_sessionStartTime = std::chrono::steady_clock::time_point();
+    m_seekStartTime = std::chrono::steady_clock::time_point();
+    m_lastUpdateTime = std::chrono::steady_clock::time_point();
+
+    m_startupTimeUs = 0;
+    m_playingTimeUs = 0;
+    m_stalledTimeUs = 0;
+    m_rebufferCount = 0;
+    m_bitrateSwitchCount = 0;
+    m_videoBitrateTimeProduct = 0.0;
+    m_videoBitrateTimeUs = 0;
+    m_seekCount = 0;
+    m_totalSeekLatencyUs = 0;
+    m_maximumSeekLatencyUs = 0;
+    m_lastSeekLatencyUs = 0;
+}
+
+void CYIBitmovinQoEMetrics::SetPlaying(bool playing, std::chrono::steady_clock::time_point now)
+{
+    Accumulate(now);
+
+    Activity previousActivity = GetActivity();
+    m_playing = playing;
+    CountStall(previousActivity);
+}
+
+void CYIBitmovinQoEMetrics::SetBuffering(bool buffering, std::chrono::steady_clock::time_point now)
+{
+    Accumulate(now);
+
+    Activity previousActivity = GetActivity();
+    m_buffering = buffering;
+    CountStall(previousActivity);
+}
+
+void CYIBitmovinQoEMetrics::SetVideoBitrateKbps(float videoBitrateKbps, std::chrono::steady_clock::time_point now)
+{
+    Accumulate(now);
+
+    // the first known bitrate of a session is not a switch, and neither is the bitrate becoming unknown
+    if (m_videoBitrateKbps > 0.0f && videoBitrateKbps > 0.0f && m_videoBitrateKbps != videoBitrateKbps)
+    {
+        m_bitrateSwitchCount++;
+    }
+
+    m_videoBitrateKbps = videoBitrateKbps;
+}
+
+void CYIBitmovinQoEMetrics::OnVideoTimeUpdated(std::chrono::steady_clock::time_point now)
+{
+    Accumulate(now);
+
+    // the playing state is reported before the first frame is shown, the first time update while playing is the first sign of progress
+    if (m_sessionStarted && !m_startupComplete && m_playing && !m_buffering && !m_seeking)
+    {
+        m_startupComplete = true;
+        m_startupTimeUs = ToMicroseconds(now - m_sessionStartTime);
+    }
+}
+
+void CYIBitmovinQoEMetrics::OnSeekStarted(std::chrono::steady_clock::time_point now)
+{
+    Accumulate(now);
+
+    m_seeking = true;
+    m_seekStartTime = now;
+}
+
+void CYIBitmovinQoEMetrics::OnSeekCompleted(std::chrono::steady_clock::time_point now)
+{
+    if (!m_seeking)
+    {
+        return;
+    }
+
+    Accumulate(now);
+
+    uint64_t seekLatencyUs = ToMicroseconds(now - m_seekStartTime);
+
+    m_seekCount++;
+    m_totalSeekLatencyUs += seekLatencyUs;
+    m_lastSeekLatencyUs = seekLatencyUs;
+
+    if (seekLatencyUs > m_maximumSeekLatencyUs)
+    {
+        m_maximumSeekLatencyUs = seekLatencyUs;
+    }
+
+    // buffering which outlasts the seek is a stall like any other
+    Activity previousActivity = GetActivity();
+    m_seeking = false;
+    CountStall(previousActivity);
+}
+
+CYIBitmovinVideoPlayer::QoESummary CYIBitmovinQoEMetrics::GetSummary(std::chrono::steady_clock::time_point now) const
+{
+    uint64_t playingTimeUs = m_playingTimeUs;
+    uint64_t stalledTimeUs = m_stalledTimeUs;
+    double videoBitrateTimeProduct = m_videoBitrateTimeProduct;
+    uint64_t videoBitrateTimeUs = m_videoBitrateTimeUs;
+
+    if (m_sessionStarted)
+    {
+        uint64_t elapsedUs = ToMicroseconds(now - m_lastUpdateTime);
+
+        switch (GetActivity())
+        {
+            case Activity::Playing:
+            {
+                playingTimeUs += elapsedUs;
+
+                if (m_videoBitrateKbps > 0.0f)
+                {
+                    videoBitrateTimeProduct += static_cast<double>(m_videoBitrateKbps) * elapsedUs;
+                    videoBitrateTimeUs += elapsedUs;
+                }
+                break;
+            }
+            case Activity::Stalled:
+            {
+                stalledTimeUs += elapsedUs;
+                break;
+            }
+            case Activity::Idle:
+            {
+                break;
+            }
+        }
+    }
+
+    CYIBitmovinVideoPlayer::QoESummary summary;
+    summary.startupComplete = m_startupComplete;
+    summary.startupTimeMs = m_startupTimeUs / 1000;
+    summary.playingTimeMs = playingTimeUs / 1000;
+    summary.stalledTimeMs = stalledTimeUs / 1000;
+    summary.rebufferCount = m_rebufferCount;
+    summary.rebufferRatio = playingTimeUs + stalledTimeUs > 0 ? static_cast<float>(static_cast<double>(stalledTimeUs) / (playingTimeUs + stalledTimeUs)) : 0.0f;
+    summary.averageVideoBitrateKbps = videoBitrateTimeUs > 0 ? static_cast<float>(videoBitrateTimeProduct / videoBitrateTimeUs) : -1.0f;
+    summary.bitrateSwitchCount = m_bitrateSwitchCount;
+    summary.seekCount = m_seekCount;
+    summary.lastSeekLatencyMs = m_lastSeekLatencyUs / 1000;
+    summary.averageSeekLatencyMs = m_seekCount > 0 ? m_totalSeekLatencyUs / m_seekCount / 1000 : 0;
+    summary.maximumSeekLatencyMs = m_maximumSeekLatencyUs / 1000;
+    return summary;
+}
+
+CYIBitmovinQoEMetrics::Activity CYIBitmovinQoEMetrics::GetActivity() const
+{
+    if (!m_startupComplete || m_seeking)
+    {
+        return Activity::Idle;
+    }
+
+    // buffering while paused does not keep the viewer waiting
+    if (!m_playing)
+    {
+        return Activity::Idle;
+    }
+
+    return m_buffering ? Activity::Stalled : Activity::Playing;
+}
+
+void CYIBitmovinQoEMetrics::Accumulate(std::chrono::steady_clock::time_point now)
+{
+    if (!m_sessionStarted)
+    {
+        return;
+    }
+
+    uint64_t elapsedUs = ToMicroseconds(now - m_lastUpdateTime);
+    m_lastUpdateTime = now;
+
+    switch (GetActivity())
+    {
+        case Activity::Playing:
+        {
+            m_playingTimeUs += elapsedUs;
+
+            // time with an unknown bitrate is left out of the average rather than counted as zero
+            if (m_videoBitrateKbps > 0.0f)
+            {
+                m_videoBitrateTimeProduct += static_cast<double>(m_videoBitrateKbps) * elapsedUs;
+                m_videoBitrateTimeUs += elapsedUs;
+            }
+            break;
+        }
+        case Activity::Stalled:
+        {
+            m_stalledTimeUs += elapsedUs;
+            break;
+        }
+        case Activity::Idle:
+        {
+            break;
+        }
+    }
+}
+
+void CYIBitmovinQoEMetrics::CountStall(Activity previousActivity)
+{
+    if (previousActivity != Activity::Stalled && GetActivity() == Activity::Stalled)
+    {
+        m_rebufferCount++;
+    }
+}
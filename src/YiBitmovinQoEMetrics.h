@@ -0,0 +1,69 @@
+#ifndef _YI_BITMOVIN_QOE_METRICS_H_
+#define _YI_BITMOVIN_QOE_METRICS_H_
+
+#include "YiBitmovinVideoPlayer.h"
+
+#include <chrono>
+#include <cstdint>
+
+// note: accumulates session level quality of experience metrics from the player events as they arrive. Every update only banks the time
+// spent in the activity which is ending, so the cost per event is constant and the metrics can be left enabled in production.
+//
+// note: a session starts when a source is prepared and startup completes on the first time update received while the player is playing.
+// Time before startup and time spent seeking is neither playing nor stalled time, and buffering during startup or a seek is not a rebuffer.
+//
+// note: not thread safe, all calls are expected to be made from the thread which dispatches the player events
+class CYIBitmovinQoEMetrics
+{
+public:
+    CYIBitmovinQoEMetrics();
+
+    void StartSession(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+    void Reset();
+
+    void SetPlaying(bool playing, std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+    void SetBuffering(bool buffering, std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+    void SetVideoBitrateKbps(float videoBitrateKbps, std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+    void OnVideoTimeUpdated(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+    void OnSeekStarted(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+    void OnSeekCompleted(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+    // note: includes the time spent in the current activity up to now, without banking it
+    CYIBitmovinVideoPlayer::QoESummary GetSummary(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now()) const;
+
+private:
+    enum class Activity
+    {
+        Idle,
+        Playing,
+        Stalled
+    };
+
+    Activity GetActivity() const;
+    void Accumulate(std::chrono::steady_clock::time_point now);
+    void CountStall(Activity previousActivity);
+
+    bool m_sessionStarted;
+    bool m_startupComplete;
+    bool m_playing;
+    bool m_buffering;
+    bool m_seeking;
+    float m_videoBitrateKbps;
+    std::chrono::steady_clock::time_point m_sessionStartTime;
+    std::chrono::steady_clock::time_point m_seekStartTime;
+    std::chrono::steady_clock::time_point m_lastUpdateTime;
+
+    uint64_t m_startupTimeUs;
+    uint64_t m_playingTimeUs;
+    uint64_t m_stalledTimeUs;
+    uint64_t m_rebufferCount;
+    uint64_t m_bitrateSwitchCount;
+    double m_videoBitrateTimeProduct; // note: kbps multiplied by microseconds of playing time with a known bitrate
+    uint64_t m_videoBitrateTimeUs;
+    uint64_t m_seekCount;
+    uint64_t m_totalSeekLatencyUs;
+    uint64_t m_maximumSeekLatencyUs;
+    uint64_t m_lastSeekLatencyUs;
+};
+
+#endif // _YI_BITMOVIN_QOE_METRICS_H_
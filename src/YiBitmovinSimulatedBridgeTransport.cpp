@@ -0,0 +1,1129 @@
+#include "YiBitmovinSimulatedBridgeTransport.h"
+
+#include <platform/YiWebMessagingBridge.h>
+
+#include <algorithm>
+
+#define LOG_TAG "CYIBitmovinSimulatedBridgeTransport"
+
+static const char *VIDEO_PLAYER_TYPE = "Bitmovin";
+static const char *VIDEO_PLAYER_VERSION = "Simulated";
+static const char *COMMAND_INSTANCE_ATTRIBUTE_NAME = "instance";
+static const char *COMMAND_FUNCTION_NAME_ATTRIBUTE_NAME = "functionName";
+static const char *COMMAND_ARGUMENTS_ATTRIBUTE_NAME = "arguments";
+static const char *COMMAND_RESULT_ATTRIBUTE_NAME = "result";
+static const char *COMMAND_ERROR_ATTRIBUTE_NAME = "error";
+static const char *EVENT_CONTEXT_NAME = "CYIBitmovinVideoPlayer";
+static const char *EVENT_INSTANCE_ID_ATTRIBUTE_NAME = "instanceId";
+static const char *TRACK_LANGUAGES[] = { "en", "fr", "de", "es" };
+static const uint32_t TRACK_LANGUAGE_COUNT = sizeof(TRACK_LANGUAGES) / sizeof(TRACK_LANGUAGES[0]);
+static const size_t MAXIMUM_PRELOADED_SOURCE_COUNT = 3;
+
+static double ToMilliseconds(std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+static const yi::rapidjson::Value *GetArgument(const yi::rapidjson::Value &arguments, yi::rapidjson::SizeType index)
+{
+    return arguments.IsArray() && index < arguments.Size() ? &arguments[index] : nullptr;
+}
+
+static const yi::rapidjson::Value *GetObjectArgument(const yi::rapidjson::Value &arguments, const char *pAttributeName)
+{
+    const yi::rapidjson::Value *pArgument = GetArgument(arguments, 0);
+
+    if (!pArgument || !pArgument->IsObject())
+    {
+        return nullptr;
+    }
+
+    yi::rapidjson::Value::ConstMemberIterator memberIterator = pArgument->FindMember(pAttributeName);
+
+    return memberIterator == pArgument->MemberEnd() ? nullptr : &memberIterator->value;
+}
+
+CYIBitmovinSimulatedBridgeTransport::CYIBitmovinSimulatedBridgeTransport(const Configuration &configuration)
+    : m_configuration(configuration)
+    , m_lastTickTime(std::chrono::steady_clock::now())
+    , m_nextEventHandlerId(1)
+    , m_callCount(0)
+    , m_eventCount(0)
+    , m_instanceCreated(false)
+    , m_instancePrewarmed(false)
+    , m_instanceId(0)
+    , m_playbackGeneration(0)
+    , m_requestedVideoTimeInterval(250)
+{
+    if (m_configuration.videoBitratesKbps.empty())
+    {
+        m_configuration.videoBitratesKbps.push_back(0);
+    }
+
+    Reset();
+
+    m_tickTimer.TimedOut.Connect(*this, &CYIBitmovinSimulatedBridgeTransport::OnTickTimerTimedOut);
+    m_tickTimer.Start(static_cast<uint64_t>(m_configuration.tickInterval.count()));
+}
+
+CYIBitmovinSimulatedBridgeTransport::~CYIBitmovinSimulatedBridgeTransport()
+{
+    m_tickTimer.Stop();
+
+    if (CYIBitmovinBridgeTransport::GetInstance() == this)
+    {
+        CYIBitmovinBridgeTransport::SetInstance(nullptr);
+    }
+}
+
+const CYIBitmovinSimulatedBridgeTransport::Configuration &CYIBitmovinSimulatedBridgeTransport::GetConfiguration() const
+{
+    return m_configuration;
+}
+
+uint64_t CYIBitmovinSimulatedBridgeTransport::GetCallCount() const
+{
+    return m_callCount;
+}
+
+uint64_t CYIBitmovinSimulatedBridgeTransport::GetEventCount() const
+{
+    return m_eventCount;
+}
+
+bool CYIBitmovinSimulatedBridgeTransport::IsConnected() const
+{
+    return true;
+}
+
+bool CYIBitmovinSimulatedBridgeTransport::Call(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, CYISignalHandler *pResponseHandlerOwner, ResponseHandler &&responseHandler)
+{
+    YI_UNUSED(pClassName);
+    YI_UNUSED(pInstanceAccessorName);
+    YI_UNUSED(command);
+
+    m_callCount++;
+
+    // the arguments may reference an allocator which does not outlive this call, so they are copied before the function is executed
+    std::shared_ptr<yi::rapidjson::Document> pArguments(new yi::rapidjson::Document());
+    pArguments->CopyFrom(arguments, pArguments->GetAllocator());
+
+    std::shared_ptr<yi::rapidjson::Document> pResult(new yi::rapidjson::Document());
+    std::shared_ptr<Response> pResponse(new Response());
+    std::shared_ptr<CYISignal<>> pCompleted;
+
+    // the response is delivered through a signal connected to the owner so that it is dropped if the owner is destroyed first
+    if (pResponseHandlerOwner && responseHandler)
+    {
+        pCompleted.reset(new CYISignal<>());
+        pCompleted->Connect(*pResponseHandlerOwner, std::function<void()>([responseHandler, pResponse]() {
+            responseHandler(*pResponse);
+        }));
+    }
+
+    CYIString functionName(pFunctionName);
+
+    Schedule(m_configuration.responseLatency, [this, target, functionName, pArguments, pResult, pResponse, pCompleted]() {
+        bool succeeded = Execute(target == Target::Instance, functionName, *pArguments, *pResult, pResponse->errorMessage);
+
+        pResponse->hasError = !succeeded;
+        pResponse->pResult = succeeded ? pResult.get() : nullptr;
+
+        if (pCompleted)
+        {
+            pCompleted->Emit();
+        }
+    });
+
+    return true;
+}
+
+CYIBitmovinBridgeTransport::CallStatus CYIBitmovinSimulatedBridgeTransport::CallAndWait(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, uint64_t timeoutMs, const ResponseHandler &responseHandler)
+{
+    YI_UNUSED(pClassName);
+    YI_UNUSED(pInstanceAccessorName);
+    YI_UNUSED(command);
+
+    // note: blocking calls are answered immediately, so the timeout can never elapse
+    YI_UNUSED(timeoutMs);
+
+    m_callCount++;
+
+    yi::rapidjson::Document result;
+    CYIString errorMessage;
+
+    bool succeeded = Execute(target == Target::Instance, pFunctionName, arguments, result, errorMessage);
+
+    if (responseHandler)
+    {
+        Response response;
+        response.hasError = !succeeded;
+        response.errorMessage = errorMessage;
+        response.pResult = succeeded ? &result : nullptr;
+
+        responseHandler(response);
+    }
+
+    return CallStatus::Received;
+}
+
+uint64_t CYIBitmovinSimulatedBridgeTransport::RegisterEventHandler(const CYIString &contextName, EventHandler &&eventHandler)
+{
+    uint64_t eventHandlerId = m_nextEventHandlerId++;
+
+    RegisteredEventHandler &registeredEventHandler = m_eventHandlers[eventHandlerId];
+    registeredEventHandler.contextName = contextName;
+    registeredEventHandler.eventHandler = std::move(eventHandler);
+
+    return eventHandlerId;
+}
+
+void CYIBitmovinSimulatedBridgeTransport::UnregisterEventHandler(uint64_t eventHandlerId)
+{
+    m_eventHandlers.erase(eventHandlerId);
+}
+
+bool CYIBitmovinSimulatedBridgeTransport::Execute(bool instance, const CYIString &functionName, const yi::rapidjson::Value &arguments, yi::rapidjson::Document &result, CYIString &errorMessage)
+{
+    if (instance)
+    {
+        if (!m_instanceCreated)
+        {
+            errorMessage = "Cannot execute " + functionName + " function, " + VIDEO_PLAYER_TYPE + " video player instance does not exist.";
+            return false;
+        }
+
+        return ExecuteInstanceFunction(functionName, arguments, result, errorMessage);
+    }
+
+    if (functionName == "createInstance")
+    {
+        if (m_instanceCreated && !m_instancePrewarmed)
+        {
+            errorMessage = CYIString("Cannot create more than one ") + VIDEO_PLAYER_TYPE + " video player instance!";
+            return false;
+        }
+
+        // a pre-warmed instance is attached to as it is, like the JS player does
+        if (!m_instancePrewarmed)
+        {
+            Reset();
+        }
+
+        m_instanceCreated = true;
+        m_instancePrewarmed = false;
+
+        const yi::rapidjson::Value *pInstanceId = GetObjectArgument(arguments, "instanceId");
+
+        m_instanceId = pInstanceId && pInstanceId->IsUint64() ? pInstanceId->GetUint64() : 0;
+
+        const yi::rapidjson::Value *pVideoTimeIntervalMs = GetObjectArgument(arguments, "videoTimeIntervalMs");
+
+        if (pVideoTimeIntervalMs && pVideoTimeIntervalMs->IsUint64())
+        {
+            m_requestedVideoTimeInterval = std::chrono::milliseconds(pVideoTimeIntervalMs->GetUint64());
+        }
+    }
+    else if (functionName == "prewarm")
+    {
+        if (!m_instanceCreated)
+        {
+            Reset();
+
+            m_instanceCreated = true;
+            m_instancePrewarmed = true;
+
+            // no native player is listening yet, the state is reported once one attaches and initializes
+            m_state = State::Initialized;
+        }
+
+        result.SetBool(true);
+    }
+    else if (functionName == "getType")
+    {
+        result.SetString(yi::rapidjson::StringRef(VIDEO_PLAYER_TYPE));
+    }
+    else if (functionName == "getVersion")
+    {
+        result.SetString(yi::rapidjson::StringRef(VIDEO_PLAYER_VERSION));
+    }
+    else if (functionName == "executeCommandBatch")
+    {
+        const yi::rapidjson::Value *pCommands = GetArgument(arguments, 0);
+
+        if (!pCommands || !pCommands->IsArray())
+        {
+            errorMessage = CYIString("Invalid ") + VIDEO_PLAYER_TYPE + " command batch, expected array.";
+            return false;
+        }
+
+        ExecuteCommandBatch(*pCommands, result);
+    }
+    else
+    {
+        errorMessage = CYIString(VIDEO_PLAYER_TYPE) + " video player does not have a static " + functionName + " function.";
+        return false;
+    }
+
+    return true;
+}
+
+bool CYIBitmovinSimulatedBridgeTransport::ExecuteInstanceFunction(const CYIString &functionName, const yi::rapidjson::Value &arguments, yi::rapidjson::Document &result, CYIString &errorMessage)
+{
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = result.GetAllocator();
+
+    if (functionName == "initialize")
+    {
+        const yi::rapidjson::Value *pName = GetArgument(arguments, 0);
+
+        if (pName && pName->IsString())
+        {
+            m_nickname = pName->GetString();
+        }
+
+        // a pre-warmed instance is already initialized, its state is re-sent for the native player which has just attached to it
+        if (m_state == State::Initialized)
+        {
+            SendStateChanged();
+            SendStateSnapshot();
+        }
+        else
+        {
+            UpdateState(State::Initialized);
+        }
+    }
+    else if (functionName == "destroy")
+    {
+        Reset();
+
+        m_instanceCreated = false;
+        m_instancePrewarmed = false;
+        m_instanceId = 0;
+        m_preloadedUrls.clear();
+    }
+    else if (functionName == "setNickname")
+    {
+        const yi::rapidjson::Value *pNickname = GetArgument(arguments, 0);
+
+        m_nickname = pNickname && pNickname->IsString() ? pNickname->GetString() : "";
+
+        SendStateSnapshot();
+    }
+    else if (functionName == "setVideoTimeInterval")
+    {
+        const yi::rapidjson::Value *pIntervalMs = GetArgument(arguments, 0);
+
+        if (!pIntervalMs || !pIntervalMs->IsUint64())
+        {
+            errorMessage = "Invalid video time interval.";
+            return false;
+        }
+
+        m_requestedVideoTimeInterval = std::chrono::milliseconds(pIntervalMs->GetUint64());
+    }
+    else if (functionName == "setVideoRectangle" || functionName == "suspend" || functionName == "restore")
+    {
+        // nothing is rendered, so there is no state to update
+    }
+    else if (functionName == "getStreamFormatSupport")
+    {
+        const yi::rapidjson::Value *pQueries = GetArgument(arguments, 0);
+
+        if (!pQueries || !pQueries->IsArray())
+        {
+            errorMessage = CYIString(VIDEO_PLAYER_TYPE) + " received invalid stream format support queries, expected array.";
+            return false;
+        }
+
+        yi::rapidjson::Value supportedValue(yi::rapidjson::kArrayType);
+
+        for (yi::rapidjson::SizeType i = 0; i < pQueries->Size(); i++)
+        {
+            supportedValue.PushBack(yi::rapidjson::Value().SetBool((*pQueries)[i].IsArray() && (*pQueries)[i].Size() > 0), allocator);
+        }
+
+        result.SetObject();
+        result.AddMember(yi::rapidjson::StringRef("version"), yi::rapidjson::StringRef(VIDEO_PLAYER_VERSION), allocator);
+        result.AddMember(yi::rapidjson::StringRef("supported"), supportedValue, allocator);
+    }
+    else if (functionName == "preloadSource")
+    {
+        const yi::rapidjson::Value *pUrl = GetObjectArgument(arguments, "url");
+
+        if (!pUrl || !pUrl->IsString() || pUrl->GetStringLength() == 0)
+        {
+            errorMessage = CYIString(VIDEO_PLAYER_TYPE) + " video player requires a non-empty url string to preload a source.";
+            return false;
+        }
+
+        CYIString url(pUrl->GetString());
+
+        if (std::find(m_preloadedUrls.begin(), m_preloadedUrls.end(), url) == m_preloadedUrls.end())
+        {
+            m_preloadedUrls.push_back(url);
+
+            while (m_preloadedUrls.size() > MAXIMUM_PRELOADED_SOURCE_COUNT)
+            {
+                m_preloadedUrls.pop_front();
+            }
+        }
+
+        result.SetBool(true);
+    }
+    else if (functionName == "prepare")
+    {
+        if (m_state == State::Uninitialized)
+        {
+            errorMessage = CYIString(VIDEO_PLAYER_TYPE) + " video player is not initialized!";
+            return false;
+        }
+
+        const yi::rapidjson::Value *pUrl = GetObjectArgument(arguments, "url");
+        std::chrono::milliseconds loadDuration = m_configuration.loadDuration;
+
+        // a preloaded source only has to be parsed and buffered, its manifest has already been fetched
+        if (pUrl && pUrl->IsString())
+        {
+            std::deque<CYIString>::iterator preloadedUrlIterator = std::find(m_preloadedUrls.begin(), m_preloadedUrls.end(), CYIString(pUrl->GetString()));
+
+            if (preloadedUrlIterator != m_preloadedUrls.end())
+            {
+                m_preloadedUrls.erase(preloadedUrlIterator);
+                loadDuration = m_configuration.preloadedLoadDuration;
+            }
+        }
+
+        const yi::rapidjson::Value *pStartTimeSeconds = GetObjectArgument(arguments, "startTimeSeconds");
+        const yi::rapidjson::Value *pMaxBitrateKbps = GetObjectArgument(arguments, "maxBitrateKbps");
+
+        m_playbackGeneration++;
+        m_currentTimeMs = pStartTimeSeconds && pStartTimeSeconds->IsNumber() ? std::max(pStartTimeSeconds->GetDouble() * 1000.0, 0.0) : 0.0;
+        m_maxBitrateKbps = pMaxBitrateKbps && pMaxBitrateKbps->IsNumber() ? static_cast<uint32_t>(std::max(pMaxBitrateKbps->GetDouble(), 0.0)) : 0;
+        m_seeking = false;
+        m_buffering = false;
+
+        UpdateState(State::Loading);
+
+        uint64_t playbackGeneration = m_playbackGeneration;
+
+        Schedule(loadDuration, [this, playbackGeneration]() {
+            if (playbackGeneration == m_playbackGeneration)
+            {
+                CompleteLoading();
+            }
+        });
+    }
+    else if (functionName == "play")
+    {
+        bool canPlay = m_state == State::Loaded || m_state == State::Paused || m_state == State::Complete;
+
+        if (canPlay)
+        {
+            if (m_state == State::Complete)
+            {
+                m_currentTimeMs = 0.0;
+            }
+
+            UpdateState(State::Playing);
+        }
+
+        result.SetBool(canPlay);
+    }
+    else if (functionName == "pause")
+    {
+        bool canPause = m_state == State::Playing;
+
+        if (canPause)
+        {
+            SendVideoTimeChanged();
+            UpdateState(State::Paused);
+        }
+
+        result.SetBool(canPause);
+    }
+    else if (functionName == "stop")
+    {
+        if (m_state != State::Uninitialized && m_state != State::Initialized)
+        {
+            m_playbackGeneration++;
+            m_currentTimeMs = 0.0;
+            m_seeking = false;
+            m_buffering = false;
+
+            UpdateState(State::Initialized);
+        }
+    }
+    else if (functionName == "seek")
+    {
+        const yi::rapidjson::Value *pTimeSeconds = GetArgument(arguments, 0);
+
+        if (!pTimeSeconds || !pTimeSeconds->IsNumber() || m_state == State::Uninitialized || m_state == State::Initialized || m_state == State::Loading)
+        {
+            result.SetBool(false);
+        }
+        else
+        {
+            double targetTimeMs = std::max(pTimeSeconds->GetDouble() * 1000.0, 0.0);
+
+            if (!m_configuration.live)
+            {
+                targetTimeMs = std::min(targetTimeMs, ToMilliseconds(m_configuration.duration));
+            }
+
+            m_seeking = true;
+
+            uint64_t playbackGeneration = m_playbackGeneration;
+
+            Schedule(m_configuration.seekDuration, [this, playbackGeneration, targetTimeMs]() {
+                if (playbackGeneration == m_playbackGeneration)
+                {
+                    CompleteSeek(targetTimeMs);
+                }
+            });
+
+            result.SetBool(true);
+        }
+    }
+    else if (functionName == "getCurrentTime")
+    {
+        result.SetDouble(m_currentTimeMs / 1000.0);
+    }
+    else if (functionName == "getDuration")
+    {
+        result.SetDouble(m_configuration.live ? -1.0 : ToMilliseconds(m_configuration.duration) / 1000.0);
+    }
+    else if (functionName == "isLive")
+    {
+        result.SetBool(m_configuration.live);
+    }
+    else if (functionName == "isMuted")
+    {
+        result.SetBool(m_muted);
+    }
+    else if (functionName == "mute" || functionName == "unmute")
+    {
+        bool muted = functionName == "mute";
+
+        if (m_muted != muted)
+        {
+            m_muted = muted;
+
+            SendMuteStatusChanged();
+        }
+    }
+    else if (functionName == "setMaxBitrate")
+    {
+        const yi::rapidjson::Value *pMaxBitrateKbps = GetArgument(arguments, 0);
+
+        m_maxBitrateKbps = pMaxBitrateKbps && pMaxBitrateKbps->IsNumber() ? static_cast<uint32_t>(std::max(pMaxBitrateKbps->GetDouble(), 0.0)) : 0;
+
+        // the simulated player switches down immediately rather than waiting for the next adaptation
+        while (m_maxBitrateKbps != 0 && m_videoBitrateIndex > 0 && m_configuration.videoBitratesKbps[m_videoBitrateIndex] > m_maxBitrateKbps)
+        {
+            m_videoBitrateIndex--;
+        }
+
+        if (m_state == State::Loaded || m_state == State::Paused || m_state == State::Playing)
+        {
+            SendBitrateChanged();
+        }
+    }
+    else if (functionName == "getAudioTracks")
+    {
+        result.CopyFrom(CreateTracksValue(m_audioTracks, m_activeAudioTrackIndex, true, allocator), allocator);
+    }
+    else if (functionName == "getTextTracks")
+    {
+        result.CopyFrom(CreateTracksValue(m_textTracks, m_activeTextTrackIndex, m_textTrackEnabled, allocator), allocator);
+    }
+    else if (functionName == "getActiveAudioTrack")
+    {
+        result.CopyFrom(CreateActiveTrackValue(m_audioTracks, m_activeAudioTrackIndex, true, allocator), allocator);
+    }
+    else if (functionName == "getActiveTextTrack")
+    {
+        result.CopyFrom(CreateActiveTrackValue(m_textTracks, m_activeTextTrackIndex, m_textTrackEnabled, allocator), allocator);
+    }
+    else if (functionName == "isTextTrackEnabled")
+    {
+        result.SetBool(m_textTrackEnabled);
+    }
+    else if (functionName == "selectAudioTrack")
+    {
+        const yi::rapidjson::Value *pId = GetArgument(arguments, 0);
+        bool selected = pId && pId->IsUint() && pId->GetUint() < m_audioTracks.size();
+
+        if (selected)
+        {
+            m_activeAudioTrackIndex = pId->GetUint();
+
+            SendActiveAudioTrackChanged();
+        }
+
+        result.SetBool(selected);
+    }
+    else if (functionName == "enableTextTrack" || functionName == "disableTextTrack")
+    {
+        bool enabled = functionName == "enableTextTrack" && !m_textTracks.empty();
+
+        if (m_textTrackEnabled != enabled)
+        {
+            m_textTrackEnabled = enabled;
+
+            SendTextTrackStatusChanged();
+            SendActiveTextTrackChanged();
+        }
+
+        result.SetBool(m_textTrackEnabled == (functionName == "enableTextTrack"));
+    }
+    else if (functionName == "selectTextTrack")
+    {
+        const yi::rapidjson::Value *pId = GetArgument(arguments, 0);
+        const yi::rapidjson::Value *pEnable = GetArgument(arguments, 1);
+        bool selected = pId && pId->IsUint() && pId->GetUint() < m_textTracks.size();
+
+        if (selected)
+        {
+            m_activeTextTrackIndex = pId->GetUint();
+
+            if (pEnable && pEnable->IsBool() && pEnable->GetBool() && !m_textTrackEnabled)
+            {
+                m_textTrackEnabled = true;
+
+                SendTextTrackStatusChanged();
+            }
+
+            SendActiveTextTrackChanged();
+        }
+
+        result.SetBool(selected);
+    }
+    else if (functionName == "addExternalTextTrack")
+    {
+        const yi::rapidjson::Value *pLabel = GetObjectArgument(arguments, "label");
+        const yi::rapidjson::Value *pLanguage = GetObjectArgument(arguments, "language");
+        const yi::rapidjson::Value *pEnable = GetObjectArgument(arguments, "enable");
+
+        Track track;
+        track.label = pLabel && pLabel->IsString() ? pLabel->GetString() : "External Subtitles";
+        track.language = pLanguage && pLanguage->IsString() ? pLanguage->GetString() : "";
+        m_textTracks.push_back(track);
+
+        SendTracksChanged();
+
+        if (pEnable && pEnable->IsBool() && pEnable->GetBool())
+        {
+            m_activeTextTrackIndex = m_textTracks.size() - 1;
+            m_textTrackEnabled = true;
+
+            SendTextTrackStatusChanged();
+            SendActiveTextTrackChanged();
+        }
+
+        result.SetBool(true);
+    }
+    else
+    {
+        errorMessage = CYIString(VIDEO_PLAYER_TYPE) + " video player does not have a " + functionName + " function.";
+        return false;
+    }
+
+    return true;
+}
+
+void CYIBitmovinSimulatedBridgeTransport::ExecuteCommandBatch(const yi::rapidjson::Value &commands, yi::rapidjson::Document &result)
+{
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = result.GetAllocator();
+
+    result.SetArray();
+
+    for (yi::rapidjson::SizeType i = 0; i < commands.Size(); i++)
+    {
+        const yi::rapidjson::Value &command = commands[i];
+        yi::rapidjson::Value commandResultValue(yi::rapidjson::kObjectType);
+        yi::rapidjson::Document commandResult;
+        CYIString errorMessage;
+        bool succeeded = false;
+
+        if (!command.IsObject() || !command.HasMember(COMMAND_FUNCTION_NAME_ATTRIBUTE_NAME) || !command[COMMAND_FUNCTION_NAME_ATTRIBUTE_NAME].IsString())
+        {
+            errorMessage = CYIString("Invalid ") + VIDEO_PLAYER_TYPE + " command at index " + CYIString::FromValue(i) + " in command batch.";
+        }
+        else
+        {
+            bool instance = command.HasMember(COMMAND_INSTANCE_ATTRIBUTE_NAME) && command[COMMAND_INSTANCE_ATTRIBUTE_NAME].IsBool() && command[COMMAND_INSTANCE_ATTRIBUTE_NAME].GetBool();
+            const yi::rapidjson::Value emptyArguments(yi::rapidjson::kArrayType);
+            const yi::rapidjson::Value &arguments = command.HasMember(COMMAND_ARGUMENTS_ATTRIBUTE_NAME) ? command[COMMAND_ARGUMENTS_ATTRIBUTE_NAME] : emptyArguments;
+
+            succeeded = Execute(instance, command[COMMAND_FUNCTION_NAME_ATTRIBUTE_NAME].GetString(), arguments, commandResult, errorMessage);
+        }
+
+        if (succeeded)
+        {
+            yi::rapidjson::Value resultValue(commandResult, allocator);
+            commandResultValue.AddMember(yi::rapidjson::StringRef(COMMAND_RESULT_ATTRIBUTE_NAME), resultValue, allocator);
+        }
+        else
+        {
+            yi::rapidjson::Value errorValue(yi::rapidjson::kObjectType);
+            yi::rapidjson::Value messageValue(errorMessage.GetData(), allocator);
+            errorValue.AddMember(yi::rapidjson::StringRef(CYIWebMessagingBridge::ERROR_MESSAGE_ATTRIBUTE_NAME), messageValue, allocator);
+            commandResultValue.AddMember(yi::rapidjson::StringRef(COMMAND_ERROR_ATTRIBUTE_NAME), errorValue, allocator);
+        }
+
+        result.PushBack(commandResultValue, allocator);
+    }
+}
+
+void CYIBitmovinSimulatedBridgeTransport::Schedule(std::chrono::steady_clock::duration delay, std::function<void()> &&action)
+{
+    ScheduledAction scheduledAction;
+    scheduledAction.dueTime = std::chrono::steady_clock::now() + delay;
+    scheduledAction.action = std::move(action);
+
+    // actions due at the same time run in the order they were scheduled, which keeps responses and events in bridge order
+    std::deque<ScheduledAction>::iterator insertIterator = std::upper_bound(m_scheduledActions.begin(), m_scheduledActions.end(), scheduledAction.dueTime, [](std::chrono::steady_clock::time_point dueTime, const ScheduledAction &other) {
+        return dueTime < other.dueTime;
+    });
+
+    m_scheduledActions.insert(insertIterator, std::move(scheduledAction));
+}
+
+void CYIBitmovinSimulatedBridgeTransport::OnTickTimerTimedOut()
+{
+    Advance(std::chrono::steady_clock::now());
+
+    m_tickTimer.Start(static_cast<uint64_t>(m_configuration.tickInterval.count()));
+}
+
+void CYIBitmovinSimulatedBridgeTransport::Advance(std::chrono::steady_clock::time_point now)
+{
+    std::chrono::steady_clock::duration elapsed = now - m_lastTickTime;
+    m_lastTickTime = now;
+
+    if (m_state == State::Playing && !m_seeking && !m_buffering)
+    {
+        m_currentTimeMs += ToMilliseconds(elapsed);
+        m_timeSinceVideoTime += elapsed;
+        m_timeSinceBitrate += elapsed;
+        m_timeSinceBuffering += elapsed;
+        m_timeSinceMetadata += elapsed;
+
+        if (!m_configuration.live && m_currentTimeMs >= ToMilliseconds(m_configuration.duration))
+        {
+            m_currentTimeMs = ToMilliseconds(m_configuration.duration);
+
+            SendVideoTimeChanged();
+            UpdateState(State::Complete);
+        }
+        else
+        {
+            // like the JS player, time changed events are throttled to the requested interval, which cannot be shorter than the rate they are raised at
+            if (m_configuration.videoTimeInterval.count() > 0 && m_requestedVideoTimeInterval.count() > 0 && m_timeSinceVideoTime >= std::max<std::chrono::steady_clock::duration>(m_configuration.videoTimeInterval, m_requestedVideoTimeInterval))
+            {
+                m_timeSinceVideoTime = std::chrono::steady_clock::duration::zero();
+
+                SendVideoTimeChanged();
+            }
+
+            if (m_configuration.bitrateInterval.count() > 0 && m_timeSinceBitrate >= m_configuration.bitrateInterval)
+            {
+                m_timeSinceBitrate = std::chrono::steady_clock::duration::zero();
+
+                size_t nextVideoBitrateIndex = (m_videoBitrateIndex + 1) % m_configuration.videoBitratesKbps.size();
+
+                if (m_maxBitrateKbps != 0 && m_configuration.videoBitratesKbps[nextVideoBitrateIndex] > m_maxBitrateKbps)
+                {
+                    nextVideoBitrateIndex = 0;
+                }
+
+                if (nextVideoBitrateIndex != m_videoBitrateIndex)
+                {
+                    m_videoBitrateIndex = nextVideoBitrateIndex;
+
+                    SendBitrateChanged();
+                }
+            }
+
+            if (m_configuration.metadataInterval.count() > 0 && m_timeSinceMetadata >= m_configuration.metadataInterval)
+            {
+                m_timeSinceMetadata = std::chrono::steady_clock::duration::zero();
+
+                SendMetadataAvailable();
+            }
+
+            if (m_configuration.bufferingInterval.count() > 0 && m_timeSinceBuffering >= m_configuration.bufferingInterval)
+            {
+                m_timeSinceBuffering = std::chrono::steady_clock::duration::zero();
+
+                StartBuffering();
+            }
+        }
+    }
+
+    // actions are removed before they run since they may schedule further actions
+    while (!m_scheduledActions.empty() && m_scheduledActions.front().dueTime <= now)
+    {
+        std::function<void()> action(std::move(m_scheduledActions.front().action));
+        m_scheduledActions.pop_front();
+
+        action();
+    }
+}
+
+void CYIBitmovinSimulatedBridgeTransport::Reset()
+{
+    m_playbackGeneration++;
+    m_state = State::Uninitialized;
+    m_nickname = CYIString();
+    m_currentTimeMs = 0.0;
+    m_muted = false;
+    m_buffering = false;
+    m_seeking = false;
+    m_maxBitrateKbps = 0;
+    m_videoBitrateIndex = 0;
+    m_initialVideoBitrateKbps = m_configuration.videoBitratesKbps[0];
+    m_stateSnapshotVersion = 0;
+    m_metadataCount = 0;
+    m_activeAudioTrackIndex = 0;
+    m_activeTextTrackIndex = 0;
+    m_textTrackEnabled = false;
+    m_timeSinceVideoTime = std::chrono::steady_clock::duration::zero();
+    m_timeSinceBitrate = std::chrono::steady_clock::duration::zero();
+    m_timeSinceBuffering = std::chrono::steady_clock::duration::zero();
+    m_timeSinceMetadata = std::chrono::steady_clock::duration::zero();
+
+    m_audioTracks.clear();
+    m_textTracks.clear();
+
+    for (uint32_t i = 0; i < m_configuration.audioTrackCount; i++)
+    {
+        Track track;
+        track.label = "Audio " + CYIString::FromValue(i + 1);
+        track.language = TRACK_LANGUAGES[i % TRACK_LANGUAGE_COUNT];
+        m_audioTracks.push_back(track);
+    }
+
+    for (uint32_t i = 0; i < m_configuration.textTrackCount; i++)
+    {
+        Track track;
+        track.label = "Subtitles " + CYIString::FromValue(i + 1);
+        track.language = TRACK_LANGUAGES[i % TRACK_LANGUAGE_COUNT];
+        m_textTracks.push_back(track);
+    }
+}
+
+void CYIBitmovinSimulatedBridgeTransport::UpdateState(State state)
+{
+    if (m_state == state)
+    {
+        return;
+    }
+
+    m_state = state;
+
+    SendStateChanged();
+    SendStateSnapshot();
+}
+
+void CYIBitmovinSimulatedBridgeTransport::CompleteLoading()
+{
+    // start with the highest bitrate allowed by the max bitrate, as an ABR algorithm settling on an initial rendition would
+    m_videoBitrateIndex = 0;
+
+    for (size_t i = 0; i < m_configuration.videoBitratesKbps.size(); i++)
+    {
+        if (m_maxBitrateKbps == 0 || m_configuration.videoBitratesKbps[i] <= m_maxBitrateKbps)
+        {
+            m_videoBitrateIndex = i;
+        }
+    }
+
+    m_initialVideoBitrateKbps = m_configuration.videoBitratesKbps[m_videoBitrateIndex];
+
+    UpdateState(State::Loaded);
+
+    yi::rapidjson::Document durationDocument;
+    SendEvent("videoDurationChanged", std::move(durationDocument), yi::rapidjson::Value(m_configuration.live ? -1.0 : ToMilliseconds(m_configuration.duration) / 1000.0));
+
+    yi::rapidjson::Document liveStatusDocument;
+    SendEvent("liveStatus", std::move(liveStatusDocument), yi::rapidjson::Value(m_configuration.live));
+
+    SendTracksChanged();
+    SendActiveAudioTrackChanged();
+    SendActiveTextTrackChanged();
+    SendBitrateChanged();
+    SendVideoTimeChanged();
+}
+
+void CYIBitmovinSimulatedBridgeTransport::CompleteSeek(double targetTimeMs)
+{
+    m_seeking = false;
+    m_currentTimeMs = targetTimeMs;
+
+    if (m_state == State::Complete && (m_configuration.live || targetTimeMs < ToMilliseconds(m_configuration.duration)))
+    {
+        UpdateState(State::Paused);
+    }
+
+    yi::rapidjson::Document seekCompletedDocument;
+    SendEvent("seekCompleted", std::move(seekCompletedDocument), yi::rapidjson::Value(m_currentTimeMs / 1000.0));
+
+    SendVideoTimeChanged();
+}
+
+void CYIBitmovinSimulatedBridgeTransport::StartBuffering()
+{
+    m_buffering = true;
+
+    SendBufferingStateChanged();
+
+    uint64_t playbackGeneration = m_playbackGeneration;
+
+    Schedule(m_configuration.bufferingDuration, [this, playbackGeneration]() {
+        if (playbackGeneration == m_playbackGeneration)
+        {
+            StopBuffering();
+        }
+    });
+}
+
+void CYIBitmovinSimulatedBridgeTransport::StopBuffering()
+{
+    m_buffering = false;
+
+    SendBufferingStateChanged();
+}
+
+double CYIBitmovinSimulatedBridgeTransport::GetBufferEndMs() const
+{
+    if (m_buffering)
+    {
+        return m_currentTimeMs;
+    }
+
+    double bufferEndMs = m_currentTimeMs + ToMilliseconds(m_configuration.bufferAhead);
+
+    return m_configuration.live ? bufferEndMs : std::min(bufferEndMs, ToMilliseconds(m_configuration.duration));
+}
+
+yi::rapidjson::Value CYIBitmovinSimulatedBridgeTransport::CreateTrackValue(const std::vector<Track> &tracks, size_t index, bool active, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator) const
+{
+    const Track &track = tracks[index];
+    yi::rapidjson::Value trackValue(yi::rapidjson::kObjectType);
+
+    CYIString uniqueId(track.label + "-" + CYIString::FromValue(index));
+    yi::rapidjson::Value uniqueIdValue(uniqueId.GetData(), allocator);
+    yi::rapidjson::Value labelValue(track.label.GetData(), allocator);
+    yi::rapidjson::Value languageValue(track.language.GetData(), allocator);
+    yi::rapidjson::Value titleValue(track.label.GetData(), allocator);
+
+    trackValue.AddMember(yi::rapidjson::StringRef("id"), yi::rapidjson::Value(static_cast<uint32_t>(index)), allocator);
+    trackValue.AddMember(yi::rapidjson::StringRef("uniqueId"), uniqueIdValue, allocator);
+    trackValue.AddMember(yi::rapidjson::StringRef("label"), labelValue, allocator);
+    trackValue.AddMember(yi::rapidjson::StringRef("language"), languageValue, allocator);
+    trackValue.AddMember(yi::rapidjson::StringRef("active"), yi::rapidjson::Value(active), allocator);
+    trackValue.AddMember(yi::rapidjson::StringRef("title"), titleValue, allocator);
+
+    return trackValue;
+}
+
+yi::rapidjson::Value CYIBitmovinSimulatedBridgeTransport::CreateTracksValue(const std::vector<Track> &tracks, size_t activeIndex, bool enabled, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator) const
+{
+    yi::rapidjson::Value tracksValue(yi::rapidjson::kArrayType);
+
+    for (size_t i = 0; i < tracks.size(); i++)
+    {
+        tracksValue.PushBack(CreateTrackValue(tracks, i, enabled && i == activeIndex, allocator), allocator);
+    }
+
+    return tracksValue;
+}
+
+yi::rapidjson::Value CYIBitmovinSimulatedBridgeTransport::CreateActiveTrackValue(const std::vector<Track> &tracks, size_t activeIndex, bool enabled, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator) const
+{
+    if (!enabled || activeIndex >= tracks.size())
+    {
+        return yi::rapidjson::Value();
+    }
+
+    return CreateTrackValue(tracks, activeIndex, true, allocator);
+}
+
+yi::rapidjson::Value CYIBitmovinSimulatedBridgeTransport::CreateBitrateValue(yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator) const
+{
+    uint32_t currentVideoBitrateKbps = m_configuration.videoBitratesKbps[m_videoBitrateIndex];
+
+    yi::rapidjson::Value bitrateValue(yi::rapidjson::kObjectType);
+    bitrateValue.AddMember(yi::rapidjson::StringRef("initialAudioBitrateKbps"), yi::rapidjson::Value(m_configuration.audioBitrateKbps), allocator);
+    bitrateValue.AddMember(yi::rapidjson::StringRef("currentAudioBitrateKbps"), yi::rapidjson::Value(m_configuration.audioBitrateKbps), allocator);
+    bitrateValue.AddMember(yi::rapidjson::StringRef("initialVideoBitrateKbps"), yi::rapidjson::Value(m_initialVideoBitrateKbps), allocator);
+    bitrateValue.AddMember(yi::rapidjson::StringRef("currentVideoBitrateKbps"), yi::rapidjson::Value(currentVideoBitrateKbps), allocator);
+    bitrateValue.AddMember(yi::rapidjson::StringRef("initialTotalBitrateKbps"), yi::rapidjson::Value(m_configuration.audioBitrateKbps + m_initialVideoBitrateKbps), allocator);
+    bitrateValue.AddMember(yi::rapidjson::StringRef("currentTotalBitrateKbps"), yi::rapidjson::Value(m_configuration.audioBitrateKbps + currentVideoBitrateKbps), allocator);
+
+    return bitrateValue;
+}
+
+void CYIBitmovinSimulatedBridgeTransport::SendEvent(const char *pEventName, yi::rapidjson::Document &&eventDocument, yi::rapidjson::Value &&data)
+{
+    m_eventCount++;
+
+    std::shared_ptr<yi::rapidjson::Document> pEventDocument(new yi::rapidjson::Document(std::move(eventDocument)));
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = pEventDocument->GetAllocator();
+
+    pEventDocument->SetObject();
+    pEventDocument->AddMember(yi::rapidjson::StringRef(CYIWebMessagingBridge::EVENT_CONTEXT_ATTRIBUTE_NAME), yi::rapidjson::StringRef(EVENT_CONTEXT_NAME), allocator);
+
+    if (m_instanceId != 0)
+    {
+        pEventDocument->AddMember(yi::rapidjson::StringRef(EVENT_INSTANCE_ID_ATTRIBUTE_NAME), yi::rapidjson::Value(m_instanceId), allocator);
+    }
+
+    pEventDocument->AddMember(yi::rapidjson::StringRef(CYIWebMessagingBridge::EVENT_NAME_ATTRIBUTE_NAME), yi::rapidjson::StringRef(pEventName), allocator);
+    pEventDocument->AddMember(yi::rapidjson::StringRef(CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME), data, allocator);
+
+    // events are dispatched from the tick rather than from within the call which produced them, as they would be by the web messaging bridge
+    Schedule(std::chrono::steady_clock::duration::zero(), [this, pEventDocument]() {
+        std::vector<uint64_t> eventHandlerIds;
+
+        for (const std::pair<const uint64_t, RegisteredEventHandler> &eventHandlerEntry : m_eventHandlers)
+        {
+            if (eventHandlerEntry.second.contextName == EVENT_CONTEXT_NAME)
+            {
+                eventHandlerIds.push_back(eventHandlerEntry.first);
+            }
+        }
+
+        // handlers may unregister themselves or each other while the event is being dispatched
+        for (uint64_t eventHandlerId : eventHandlerIds)
+        {
+            std::map<uint64_t, RegisteredEventHandler>::iterator eventHandlerIterator = m_eventHandlers.find(eventHandlerId);
+
+            if (eventHandlerIterator != m_eventHandlers.end())
+            {
+                EventHandler eventHandler(eventHandlerIterator->second.eventHandler);
+
+                eventHandler(*pEventDocument);
+            }
+        }
+    });
+}
+
+void CYIBitmovinSimulatedBridgeTransport::SendStateChanged()
+{
+    yi::rapidjson::Document eventDocument;
+    SendEvent("stateChanged", std::move(eventDocument), yi::rapidjson::Value(static_cast<int32_t>(m_state)));
+}
+
+void CYIBitmovinSimulatedBridgeTransport::SendStateSnapshot()
+{
+    yi::rapidjson::Document eventDocument;
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = eventDocument.GetAllocator();
+
+    m_stateSnapshotVersion++;
+
+    yi::rapidjson::Value snapshotValue(yi::rapidjson::kObjectType);
+    yi::rapidjson::Value nicknameValue(m_nickname.GetData(), allocator);
+
+    snapshotValue.AddMember(yi::rapidjson::StringRef("version"), yi::rapidjson::Value(static_cast<uint64_t>(m_stateSnapshotVersion)), allocator);
+    snapshotValue.AddMember(yi::rapidjson::StringRef("state"), yi::rapidjson::Value(static_cast<int32_t>(m_state)), allocator);
+    snapshotValue.AddMember(yi::rapidjson::StringRef("nickname"), nicknameValue, allocator);
+    snapshotValue.AddMember(yi::rapidjson::StringRef("muted"), yi::rapidjson::Value(m_muted), allocator);
+    snapshotValue.AddMember(yi::rapidjson::StringRef("textTrackEnabled"), yi::rapidjson::Value(m_textTrackEnabled), allocator);
+    snapshotValue.AddMember(yi::rapidjson::StringRef("activeAudioTrack"), CreateActiveTrackValue(m_audioTracks, m_activeAudioTrackIndex, true, allocator), allocator);
+    snapshotValue.AddMember(yi::rapidjson::StringRef("activeTextTrack"), CreateActiveTrackValue(m_textTracks, m_activeTextTrackIndex, m_textTrackEnabled, allocator), allocator);
+
+    SendEvent("stateSnapshot", std::move(eventDocument), std::move(snapshotValue));
+}
+
+void CYIBitmovinSimulatedBridgeTransport::SendVideoTimeChanged()
+{
+    yi::rapidjson::Document eventDocument;
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = eventDocument.GetAllocator();
+
+    double bufferEndMs = GetBufferEndMs();
+
+    // note: uses the same packed layout as the JS player, [currentTimeSeconds, bufferStartMs, bufferEndMs, bufferLengthMs]
+    yi::rapidjson::Value videoTimeValue(yi::rapidjson::kArrayType);
+    videoTimeValue.PushBack(yi::rapidjson::Value(m_currentTimeMs / 1000.0), allocator);
+    videoTimeValue.PushBack(yi::rapidjson::Value(static_cast<int64_t>(m_currentTimeMs)), allocator);
+    videoTimeValue.PushBack(yi::rapidjson::Value(static_cast<int64_t>(bufferEndMs)), allocator);
+    videoTimeValue.PushBack(yi::rapidjson::Value(static_cast<int64_t>(bufferEndMs - m_currentTimeMs)), allocator);
+
+    SendEvent("videoTimeChanged", std::move(eventDocument), std::move(videoTimeValue));
+}
+
+void CYIBitmovinSimulatedBridgeTransport::SendBitrateChanged()
+{
+    yi::rapidjson::Document eventDocument;
+    yi::rapidjson::Value bitrateValue(CreateBitrateValue(eventDocument.GetAllocator()));
+
+    SendEvent("bitrateChanged", std::move(eventDocument), std::move(bitrateValue));
+}
+
+void CYIBitmovinSimulatedBridgeTransport::SendBufferingStateChanged()
+{
+    yi::rapidjson::Document eventDocument;
+    SendEvent("bufferingStateChanged", std::move(eventDocument), yi::rapidjson::Value(m_buffering));
+}
+
+void CYIBitmovinSimulatedBridgeTransport::SendTracksChanged()
+{
+    yi::rapidjson::Document audioTracksDocument;
+    yi::rapidjson::Value audioTracksValue(CreateTracksValue(m_audioTracks, m_activeAudioTrackIndex, true, audioTracksDocument.GetAllocator()));
+    SendEvent("audioTracksChanged", std::move(audioTracksDocument), std::move(audioTracksValue));
+
+    yi::rapidjson::Document textTracksDocument;
+    yi::rapidjson::Value textTracksValue(CreateTracksValue(m_textTracks, m_activeTextTrackIndex, m_textTrackEnabled, textTracksDocument.GetAllocator()));
+    SendEvent("textTracksChanged", std::move(textTracksDocument), std::move(textTracksValue));
+}
+
+void CYIBitmovinSimulatedBridgeTransport::SendActiveAudioTrackChanged()
+{
+    yi::rapidjson::Document eventDocument;
+    yi::rapidjson::Value trackValue(CreateActiveTrackValue(m_audioTracks, m_activeAudioTrackIndex, true, eventDocument.GetAllocator()));
+
+    SendEvent("activeAudioTrackChanged", std::move(eventDocument), std::move(trackValue));
+}
+
+void CYIBitmovinSimulatedBridgeTransport::SendActiveTextTrackChanged()
+{
+    yi::rapidjson::Document eventDocument;
+    yi::rapidjson::Value trackValue(CreateActiveTrackValue(m_textTracks, m_activeTextTrackIndex, m_textTrackEnabled, eventDocument.GetAllocator()));
+
+    SendEvent("activeTextTrackChanged", std::move(eventDocument), std::move(trackValue));
+}
+
+void CYIBitmovinSimulatedBridgeTransport::SendTextTrackStatusChanged()
+{
+    yi::rapidjson::Document eventDocument;
+    SendEvent("textTrackStatusChanged", std::move(eventDocument), yi::rapidjson::Value(m_textTrackEnabled));
+}
+
+void CYIBitmovinSimulatedBridgeTransport::SendMuteStatusChanged()
+{
+    yi::rapidjson::Document eventDocument;
+    SendEvent("muteStatusChanged", std::move(eventDocument), yi::rapidjson::Value(m_muted));
+}
+
+void CYIBitmovinSimulatedBridgeTransport::SendMetadataAvailable()
+{
+    yi::rapidjson::Document eventDocument;
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = eventDocument.GetAllocator();
+
+    m_metadataCount++;
+
+    CYIString value(CYIString::FromValue(m_metadataCount));
+    int64_t timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+    yi::rapidjson::Value metadataValue(yi::rapidjson::kObjectType);
+    yi::rapidjson::Value valueValue(value.GetData(), allocator);
+
+    metadataValue.AddMember(yi::rapidjson::StringRef("identifier"), yi::rapidjson::StringRef("simulated"), allocator);
+    metadataValue.AddMember(yi::rapidjson::StringRef("value"), valueValue, allocator);
+    metadataValue.AddMember(yi::rapidjson::StringRef("timestamp"), yi::rapidjson::Value(timestamp), allocator);
+    metadataValue.AddMember(yi::rapidjson::StringRef("durationMs"), yi::rapidjson::Value(-1), allocator);
+
+    SendEvent("metadataAvailable", std::move(eventDocument), std::move(metadataValue));
+}
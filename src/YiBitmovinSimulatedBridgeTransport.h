@@ -0,0 +1,156 @@
+#ifndef _YI_BITMOVIN_SIMULATED_BRIDGE_TRANSPORT_H_
+#define _YI_BITMOVIN_SIMULATED_BRIDGE_TRANSPORT_H_
+
+#include "YiBitmovinBridgeTransport.h"
+
+#include <signal/YiSignal.h>
+#include <signal/YiSignalHandler.h>
+#include <utility/YiTimer.h>
+
+#include <chrono>
+#include <deque>
+#include <map>
+#include <memory>
+#include <vector>
+
+// note: simulates the JS CYIBitmovinVideoPlayer state machine natively so that the wrapper can be exercised without a web messaging bridge
+class CYIBitmovinSimulatedBridgeTransport : public CYIBitmovinBridgeTransport, public CYISignalHandler
+{
+public:
+    struct Configuration
+    {
+        std::chrono::milliseconds responseLatency{2};
+        std::chrono::milliseconds tickInterval{10};
+        std::chrono::milliseconds videoTimeInterval{250};
+        std::chrono::milliseconds bitrateInterval{10000};
+        std::chrono::milliseconds bufferingInterval{0}; // note: 0 disables simulated stalls
+        std::chrono::milliseconds bufferingDuration{500};
+        std::chrono::milliseconds metadataInterval{0}; // note: 0 disables simulated metadata
+        std::chrono::milliseconds loadDuration{300};
+        std::chrono::milliseconds preloadedLoadDuration{50};
+        std::chrono::milliseconds seekDuration{100};
+        std::chrono::milliseconds duration{600000};
+        std::chrono::milliseconds bufferAhead{30000};
+        bool live = false;
+        uint32_t audioTrackCount = 2;
+        uint32_t textTrackCount = 2;
+        uint32_t audioBitrateKbps = 128;
+        std::vector<uint32_t> videoBitratesKbps{800, 1600, 3200, 6000};
+    };
+
+    CYIBitmovinSimulatedBridgeTransport(const Configuration &configuration = Configuration());
+    virtual ~CYIBitmovinSimulatedBridgeTransport();
+
+    const Configuration &GetConfiguration() const;
+    uint64_t GetCallCount() const;
+    uint64_t GetEventCount() const;
+
+    virtual bool IsConnected() const override;
+    virtual bool Call(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, CYISignalHandler *pResponseHandlerOwner = nullptr, ResponseHandler &&responseHandler = ResponseHandler()) override;
+    virtual CallStatus CallAndWait(Target target, const char *pClassName, const char *pInstanceAccessorName, const char *pFunctionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, uint64_t timeoutMs, const ResponseHandler &responseHandler) override;
+    virtual uint64_t RegisterEventHandler(const CYIString &contextName, EventHandler &&eventHandler) override;
+    virtual void UnregisterEventHandler(uint64_t eventHandlerId) override;
+
+private:
+    // note: mirrors the state ids used by the JS player
+    enum class State
+    {
+        Uninitialized = 0,
+        Initialized = 1,
+        Loading = 2,
+        Loaded = 3,
+        Paused = 4,
+        Playing = 5,
+        Complete = 6
+    };
+
+    struct Track
+    {
+        CYIString label;
+        CYIString language;
+    };
+
+    struct ScheduledAction
+    {
+        std::chrono::steady_clock::time_point dueTime;
+        std::function<void()> action;
+    };
+
+    struct RegisteredEventHandler
+    {
+        CYIString contextName;
+        EventHandler eventHandler;
+    };
+
+    bool Execute(bool instance, const CYIString &functionName, const yi::rapidjson::Value &arguments, yi::rapidjson::Document &result, CYIString &errorMessage);
+    bool ExecuteInstanceFunction(const CYIString &functionName, const yi::rapidjson::Value &arguments, yi::rapidjson::Document &result, CYIString &errorMessage);
+    void ExecuteCommandBatch(const yi::rapidjson::Value &commands, yi::rapidjson::Document &result);
+
+    void Schedule(std::chrono::steady_clock::duration delay, std::function<void()> &&action);
+    void OnTickTimerTimedOut();
+    void Advance(std::chrono::steady_clock::time_point now);
+
+    void Reset();
+    void UpdateState(State state);
+    void CompleteLoading();
+    void CompleteSeek(double targetTimeMs);
+    void StartBuffering();
+    void StopBuffering();
+    double GetBufferEndMs() const;
+
+    yi::rapidjson::Value CreateTrackValue(const std::vector<Track> &tracks, size_t index, bool active, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator) const;
+    yi::rapidjson::Value CreateTracksValue(const std::vector<Track> &tracks, size_t activeIndex, bool enabled, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator) const;
+    yi::rapidjson::Value CreateActiveTrackValue(const std::vector<Track> &tracks, size_t activeIndex, bool enabled, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator) const;
+    yi::rapidjson::Value CreateBitrateValue(yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator) const;
+
+    void SendEvent(const char *pEventName, yi::rapidjson::Document &&eventDocument, yi::rapidjson::Value &&data);
+    void SendStateChanged();
+    void SendStateSnapshot();
+    void SendVideoTimeChanged();
+    void SendBitrateChanged();
+    void SendBufferingStateChanged();
+    void SendTracksChanged();
+    void SendActiveAudioTrackChanged();
+    void SendActiveTextTrackChanged();
+    void SendTextTrackStatusChanged();
+    void SendMuteStatusChanged();
+    void SendMetadataAvailable();
+
+    Configuration m_configuration;
+    CYITimer m_tickTimer;
+    std::chrono::steady_clock::time_point m_lastTickTime;
+    std::deque<ScheduledAction> m_scheduledActions;
+    std::map<uint64_t, RegisteredEventHandler> m_eventHandlers;
+    uint64_t m_nextEventHandlerId;
+    uint64_t m_callCount;
+    uint64_t m_eventCount;
+
+    bool m_instanceCreated;
+    bool m_instancePrewarmed;
+    uint64_t m_instanceId; // note: only a single player is simulated, events are tagged with the instance ID of the native player which created it
+    std::deque<CYIString> m_preloadedUrls;
+    uint64_t m_playbackGeneration;
+    State m_state;
+    CYIString m_nickname;
+    double m_currentTimeMs;
+    bool m_muted;
+    bool m_buffering;
+    bool m_seeking;
+    uint32_t m_maxBitrateKbps;
+    size_t m_videoBitrateIndex;
+    uint32_t m_initialVideoBitrateKbps;
+    uint64_t m_stateSnapshotVersion;
+    uint64_t m_metadataCount;
+    std::vector<Track> m_audioTracks;
+    std::vector<Track> m_textTracks;
+    size_t m_activeAudioTrackIndex;
+    size_t m_activeTextTrackIndex;
+    bool m_textTrackEnabled;
+    std::chrono::milliseconds m_requestedVideoTimeInterval;
+    std::chrono::steady_clock::duration m_timeSinceVideoTime;
+    std::chrono::steady_clock::duration m_timeSinceBitrate;
+    std::chrono::steady_clock::duration m_timeSinceBuffering;
+    std::chrono::steady_clock::duration m_timeSinceMetadata;
+};
+
+#endif // _YI_BITMOVIN_SIMULATED_BRIDGE_TRANSPORT_H_
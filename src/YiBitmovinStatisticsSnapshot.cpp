@@ -0,0 +1,115 @@
+#include "YiBitmovinStatisticsSnapshot.h"
+
+static bool AreStatisticsEqual(const CYIAbstractVideoPlayer::Statistics &left, const CYIAbstractVideoPlayer::Statistics &right)
+{
+    return left.isLive == right.isLive &&
+        left.audioBitrateKbps == right.audioBitrateKbps &&
+        left.defaultAudioBitrateKbps == right.defaultAudioBitrateKbps &&
+        left.videoBitrateKbps == right.videoBitrateKbps &&
+        left.defaultVideoBitrateKbps == right.defaultVideoBitrateKbps &&
+        left.totalBitrateKbps == right.totalBitrateKbps &&
+        left.defaultTotalBitrateKbps == right.defaultTotalBitrateKbps &&
+        left.bufferLengthMs == right.bufferLengthMs;
+}
+
+CYIBitmovinStatisticsSnapshot::CYIBitmovinStatisticsSnapshot()
+    : m_sequence(0)
+{
+    Store(CreateEmptyStatistics());
+}
+
+bool CYIBitmovinStatisticsSnapshot::Publish(const CYIAbstractVideoPlayer::Statistics &statistics)
+{
+    // there is a single publisher, so the values it reads back here cannot be mid-update
+    if (AreStatisticsEqual(Load(), statistics))
+    {
+        return false;
+    }
+
+    uint64_t sequence = m_sequence.load(std::memory_order_relaxed);
+
+    m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    Store(statistics);
+
+    m_sequence.store(sequence + 2, std::memory_order_release);
+
+    return true;
+}
+
+CYIAbstractVideoPlayer::Statistics CYIBitmovinStatisticsSnapshot::Read(uint64_t *pGeneration) const
+{
+    CYIAbstractVideoPlayer::Statistics statistics;
+    uint64_t sequenceBefore = 0;
+    uint64_t sequenceAfter = 0;
+
+    do
+    {
+        sequenceBefore = m_sequence.load(std::memory_order_acquire);
+
+        // a publish is in progress, the values may be a mix of the old and new statistics
+        if (sequenceBefore & 1)
+        {
+            sequenceAfter = sequenceBefore + 1;
+            continue;
+        }
+
+        statistics = Load();
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        sequenceAfter = m_sequence.load(std::memory_order_relaxed);
+    } while (sequenceBefore != sequenceAfter);
+
+    if (pGeneration)
+    {
+        *pGeneration = sequenceBefore / 2;
+    }
+
+    return statistics;
+}
+
+uint64_t CYIBitmovinStatisticsSnapshot::GetGeneration() const
+{
+    return m_sequence.load(std::memory_order_acquire) / 2;
+}
+
+CYIAbstractVideoPlayer::Statistics CYIBitmovinStatisticsSnapshot::CreateEmptyStatistics()
+{
+    CYIAbstractVideoPlayer::Statistics statistics;
+    statistics.isLive = false;
+    statistics.audioBitrateKbps = -1.0f;
+    statistics.defaultAudioBitrateKbps = -1.0f;
+    statistics.videoBitrateKbps = -1.0f;
+    statistics.defaultVideoBitrateKbps = -1.0f;
+    statistics.totalBitrateKbps = -1.0f;
+    statistics.defaultTotalBitrateKbps = -1.0f;
+    statistics.bufferLengthMs = -1.0f;
+    return statistics;
+}
+
+void CYIBitmovinStatisticsSnapshot::Store(const CYIAbstractVideoPlayer::Statistics &statistics)
+{
+    m_values.isLive.store(statistics.isLive, std::memory_order_relaxed);
+    m_values.audioBitrateKbps.store(statistics.audioBitrateKbps, std::memory_order_relaxed);
+    m_values.defaultAudioBitrateKbps.store(statistics.defaultAudioBitrateKbps, std::memory_order_relaxed);
+    m_values.videoBitrateKbps.store(statistics.videoBitrateKbps, std::memory_order_relaxed);
+    m_values.defaultVideoBitrateKbps.store(statistics.defaultVideoBitrateKbps, std::memory_order_relaxed);
+    m_values.totalBitrateKbps.store(statistics.totalBitrateKbps, std::memory_order_relaxed);
+    m_values.defaultTotalBitrateKbps.store(statistics.defaultTotalBitrateKbps, std::memory_order_relaxed);
+    m_values.bufferLengthMs.store(statistics.bufferLengthMs, std::memory_order_relaxed);
+}
+
+CYIAbstractVideoPlayer::Statistics CYIBitmovinStatisticsSnapshot::Load() const
+{
+    CYIAbstractVideoPlayer::Statistics statistics;
+    statistics.isLive = m_values.isLive.load(std::memory_order_relaxed);
+    statistics.audioBitrateKbps = m_values.audioBitrateKbps.load(std::memory_order_relaxed);
+    statistics.defaultAudioBitrateKbps = m_values.defaultAudioBitrateKbps.load(std::memory_order_relaxed);
+    statistics.videoBitrateKbps = m_values.videoBitrateKbps.load(std::memory_order_relaxed);
+    statistics.defaultVideoBitrateKbps = m_values.defaultVideoBitrateKbps.load(std::memory_order_relaxed);
+    statistics.totalBitrateKbps = m_values.totalBitrateKbps.load(std::memory_order_relaxed);
+    statistics.defaultTotalBitrateKbps = m_values.defaultTotalBitrateKbps.load(std::memory_order_relaxed);
+    statistics.bufferLengthMs = m_values.bufferLengthMs.load(std::memory_order_relaxed);
+    return statistics;
+}
@@ -0,0 +1,48 @@
+#ifndef _YI_BITMOVIN_STATISTICS_SNAPSHOT_H_
+#define _YI_BITMOVIN_STATISTICS_SNAPSHOT_H_
+
+#include <player/YiAbstractVideoPlayer.h>
+
+#include <atomic>
+#include <cstdint>
+
+// note: holds the player statistics as a single block guarded by a sequence lock, so that readers always see a consistent set of values
+// rather than a mix of values from before and after an update. The generation only advances when the published values change, which
+// lets readers skip work when nothing has changed since their last read.
+//
+// note: only one thread may publish, any number of threads may read
+class CYIBitmovinStatisticsSnapshot
+{
+public:
+    CYIBitmovinStatisticsSnapshot();
+
+    // note: returns false, leaving the generation unchanged, if the statistics are identical to the ones already published
+    bool Publish(const CYIAbstractVideoPlayer::Statistics &statistics);
+
+    CYIAbstractVideoPlayer::Statistics Read(uint64_t *pGeneration = nullptr) const;
+    uint64_t GetGeneration() const;
+
+    static CYIAbstractVideoPlayer::Statistics CreateEmptyStatistics();
+
+private:
+    struct Values
+    {
+        std::atomic<bool> isLive;
+        std::atomic<float> audioBitrateKbps;
+        std::atomic<float> defaultAudioBitrateKbps;
+        std::atomic<float> videoBitrateKbps;
+        std::atomic<float> defaultVideoBitrateKbps;
+        std::atomic<float> totalBitrateKbps;
+        std::atomic<float> defaultTotalBitrateKbps;
+        std::atomic<float> bufferLengthMs;
+    };
+
+    void Store(const CYIAbstractVideoPlayer::Statistics &statistics);
+    CYIAbstractVideoPlayer::Statistics Load() const;
+
+    // note: odd while a publish is in progress, the generation is half of the sequence
+    std::atomic<uint64_t> m_sequence;
+    Values m_values;
+};
+
+#endif // _YI_BITMOVIN_STATISTICS_SNAPSHOT_H_
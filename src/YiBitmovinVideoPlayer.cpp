@@ -3,11 +3,15 @@
 #include "YiBitmovinVideoPlayerPriv.h"
 #include "YiBitmovinVideoSurface.h"
 
-#include <platform/YiWebBridgeLocator.h>
 #include <player/YiPlayReadyDRMConfiguration.h>
 #include <player/YiVideoPlayerStateManager.h>
 #include <player/YiWidevineModularDRMConfiguration.h>
 
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
 #define LOG_TAG "CYIBitmovinVideoPlayer"
 
 YI_TYPE_DEF(CYIBitmovinVideoPlayer, CYIAbstractVideoPlayer);
@@ -15,6 +19,60 @@ YI_TYPE_DEF(CYIBitmovinVideoPlayer, CYIAbstractVideoPlayer);
 static const char *VIDEO_PLAYER_CLASS_NAME = "CYIBitmovinVideoPlayer";
 static const char *VIDEO_PLAYER_INSTANCE_ACCESSOR_NAME = "getInstance";
 static const double BITRATE_KBPS_SCALE = 1000.0;
+static const uint64_t SEEK_TIMEOUT_MS = 5000;
+static const yi::rapidjson::SizeType VIDEO_TIME_CURRENT_TIME_INDEX = 0;
+static const yi::rapidjson::SizeType VIDEO_TIME_BUFFER_LENGTH_INDEX = 3;
+static const char *CAPABILITY_VERSION_ATTRIBUTE_NAME = "version";
+static const char *CAPABILITY_SUPPORTED_ATTRIBUTE_NAME = "supported";
+static const char *PLAYER_CONFIGURATION_VIDEO_TIME_INTERVAL_ATTRIBUTE_NAME = "videoTimeIntervalMs";
+static const char *PLAYER_CONFIGURATION_INSTANCE_ID_ATTRIBUTE_NAME = "instanceId";
+static const std::chrono::milliseconds DEFAULT_VIDEO_TIME_UPDATE_INTERVAL(250);
+static const size_t DEFAULT_BITRATE_HISTORY_MEMORY_BUDGET_BYTES = 128 * 1024;
+
+static const CYIAbstractVideoPlayer::StreamingFormat STREAMING_FORMATS[] = {
+    CYIAbstractVideoPlayer::StreamingFormat::HLS,
+    CYIAbstractVideoPlayer::StreamingFormat::Smooth,
+    CYIAbstractVideoPlayer::StreamingFormat::DASH,
+    CYIAbstractVideoPlayer::StreamingFormat::MP4
+};
+
+static const CYIAbstractVideoPlayer::DRMScheme DRM_SCHEMES[] = {
+    CYIAbstractVideoPlayer::DRMScheme::None,
+    CYIAbstractVideoPlayer::DRMScheme::FairPlay,
+    CYIAbstractVideoPlayer::DRMScheme::PlayReady,
+    CYIAbstractVideoPlayer::DRMScheme::WidevineModular,
+    CYIAbstractVideoPlayer::DRMScheme::WidevineModularCustomRequest
+};
+
+CYIBitmovinVideoPlayerPriv::CapabilityMatrix CYIBitmovinVideoPlayerPriv::s_capabilityMatrix;
+bool CYIBitmovinVideoPlayerPriv::s_capabilityMatrixRevalidated = false;
+bool CYIBitmovinVideoPlayerPriv::s_capabilityLookupFailed = false;
+CYIString CYIBitmovinVideoPlayerPriv::s_playerVersion;
+const CYIBitmovinVideoPlayerPriv *CYIBitmovinVideoPlayerPriv::s_pCapabilityProbeOwner = nullptr;
+CYIString CYIBitmovinVideoPlayerPriv::s_capabilityCacheFilePath;
+CYIBitmovinLatencyRecorder CYIBitmovinVideoPlayerPriv::s_latencyRecorder;
+std::unique_ptr<CYIBitmovinBridgeRecorder> CYIBitmovinVideoPlayerPriv::s_pBridgeRecorder;
+std::unique_ptr<CYIBitmovinVideoPlayerPriv::PlayerPrewarm> CYIBitmovinVideoPlayerPriv::s_pPlayerPrewarm;
+uint64_t CYIBitmovinVideoPlayerPriv::s_nextInstanceId = 1;
+
+static yi::rapidjson::Document CreatePlayerConfigurationDocument(const std::map<CYIString, CYIString> &playerConfiguration)
+{
+    yi::rapidjson::Document playerConfigurationDocument(yi::rapidjson::kObjectType);
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = playerConfigurationDocument.GetAllocator();
+
+    for(std::map<CYIString, CYIString>::const_iterator playerConfigIterator = playerConfiguration.begin(); playerConfigIterator != playerConfiguration.end(); playerConfigIterator++)
+    {
+        if(playerConfigIterator->first.IsEmpty()) {
+            continue;
+        }
+
+        yi::rapidjson::Value configKeyValue(playerConfigIterator->first.GetData(), allocator);
+        yi::rapidjson::Value configValueValue(playerConfigIterator->second.GetData(), allocator);
+        playerConfigurationDocument.AddMember(configKeyValue, configValueValue, allocator);
+    }
+
+    return playerConfigurationDocument;
+}
 
 CYIString StreamFormatToString(CYIAbstractVideoPlayer::StreamingFormat streamFormat)
 {
@@ -108,12 +166,16 @@ CYIString CYIBitmovinVideoPlayerPriv::PlayerStateToString(PlayerState state)
 }
 
 CYIBitmovinVideoPlayerPriv::CYIBitmovinVideoPlayerPriv(CYIBitmovinVideoPlayer *pPub, yi::rapidjson::Document &&playerConfiguration)
-    : m_messageHandlersRegistered(false)
+    : m_videoRectangleKeyframeInterval(0)
+    , m_videoRectangleKeyframePending(false)
+    , m_videoTimeUpdateInterval(DEFAULT_VIDEO_TIME_UPDATE_INTERVAL)
+    , m_playerInstanceCreated(false)
     , m_stateBeforeBuffering(CYIAbstractVideoPlayer::PlaybackState::Paused)
     , m_currentTimeMs(0)
     , m_durationMs(0)
     , m_buffering(false)
     , m_isLive(false)
+    , m_playing(false)
     , m_initialAudioBitrateKbps(-1.0f)
     , m_currentAudioBitrateKbps(-1.0f)
     , m_initialVideoBitrateKbps(-1.0f)
@@ -121,39 +183,135 @@ CYIBitmovinVideoPlayerPriv::CYIBitmovinVideoPlayerPriv(CYIBitmovinVideoPlayer *p
     , m_initialTotalBitrateKbps(-1.0f)
     , m_currentTotalBitrateKbps(-1.0f)
     , m_bufferLengthMs(-1.0f)
+    , m_bitrateHistory(DEFAULT_BITRATE_HISTORY_MEMORY_BUDGET_BYTES)
+    , m_seekInFlight(false)
+    , m_seekQueued(false)
+    , m_queuedSeekPositionMs(0)
+    , m_coalescedSeekCount(0)
+    , m_stateSnapshotVersion(0)
+    , m_muted(false)
+    , m_textTrackEnabled(false)
+    , m_activeAudioTrack(0)
+    , m_activeTextTrack(0)
+    , m_instanceId(s_nextInstanceId++)
+    , m_instanceAccessorName(CYIString(VIDEO_PLAYER_INSTANCE_ACCESSOR_NAME) + CYIString::FromValue(m_instanceId))
     , m_playerConfiguration(std::move(playerConfiguration))
-    , m_bitrateChangedEventHandlerId(0)
-    , m_bufferingStateChangedEventHandlerId(0)
-    , m_liveStatusEventHandlerId(0)
-    , m_playerErrorEventHandlerId(0)
-    , m_audioTracksChangedEventHandlerId(0)
-    , m_videoDurationChangedEventHandlerId(0)
-    , m_videoTimeChangedEventHandlerId(0)
-    , m_stateChangedEventHandlerId(0)
-    , m_textTracksChangedEventHandlerId(0)
-    , m_metadataAvailableEventHandlerId(0)
+    , m_commandPipeline(VIDEO_PLAYER_CLASS_NAME, m_instanceAccessorName, m_instanceId)
+    , m_eventDispatcher(VIDEO_PLAYER_CLASS_NAME, m_instanceId)
     , m_pPub(pPub)
 {
+    m_commandPipeline.SetLatencyRecorder(&s_latencyRecorder);
+    m_commandPipeline.SetFailureCallback([this](const char *pFunctionName, const CYIBitmovinCommandPipeline::Result &result) {
+        NotifyCommandFailed(pFunctionName, result);
+    });
+
+    m_seekTimeoutTimer.TimedOut.Connect(*this, &CYIBitmovinVideoPlayerPriv::OnSeekTimeoutTimerTimedOut);
+    m_videoRectangleKeyframeTimer.TimedOut.Connect(*this, &CYIBitmovinVideoPlayerPriv::OnVideoRectangleKeyframeTimerTimedOut);
+
+    AddEventHandlers();
     RegisterEventHandlers();
 }
 
 CYIBitmovinVideoPlayerPriv::~CYIBitmovinVideoPlayerPriv()
 {
+    // the probe response is dropped along with the rest of the pending commands, another player may probe in its place
+    if (s_pCapabilityProbeOwner == this)
+    {
+        s_pCapabilityProbeOwner = nullptr;
+    }
+
+    m_commandPipeline.CancelAll();
     DestroyPlayerInstance();
     UnregisterEventHandlers();
+
+    // a pre-warm which failed or was consumed while its response was outstanding could not be released at the time
+    ReleaseIdlePlayerPrewarm();
 }
 
 void CYIBitmovinVideoPlayerPriv::SetVideoRectangle(const YI_RECT_REL &videoRectangle)
 {
-    static const char *FUNCTION_NAME = "setVideoRectangle";
-
     if(videoRectangle == m_previousVideoRectangle) {
         return;
     }
 
     m_previousVideoRectangle = videoRectangle;
 
-    yi::rapidjson::Document command(yi::rapidjson::kObjectType);
+    if (m_videoRectangleKeyframeInterval.count() == 0)
+    {
+        SendVideoRectangle(videoRectangle);
+        return;
+    }
+
+    // the latest rectangle is sent once the keyframe timer fires
+    if (m_videoRectangleKeyframePending)
+    {
+        return;
+    }
+
+    std::chrono::steady_clock::duration timeSinceLastKeyframe = std::chrono::steady_clock::now() - m_lastVideoRectangleKeyframeTime;
+
+    if (timeSinceLastKeyframe >= m_videoRectangleKeyframeInterval)
+    {
+        SendVideoRectangle(videoRectangle);
+    }
+    else
+    {
+        m_videoRectangleKeyframePending = true;
+        m_videoRectangleKeyframeTimer.Start(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(m_videoRectangleKeyframeInterval - timeSinceLastKeyframe).count()));
+    }
+}
+
+void CYIBitmovinVideoPlayerPriv::SetVideoRectangleKeyframeInterval(std::chrono::milliseconds keyframeInterval)
+{
+    m_videoRectangleKeyframeInterval = std::max(keyframeInterval, std::chrono::milliseconds(0));
+
+    if (m_videoRectangleKeyframePending && m_videoRectangleKeyframeInterval.count() == 0)
+    {
+        m_videoRectangleKeyframeTimer.Stop();
+        OnVideoRectangleKeyframeTimerTimedOut();
+    }
+}
+
+void CYIBitmovinVideoPlayerPriv::SetVideoTimeUpdateInterval(std::chrono::milliseconds interval)
+{
+    static const char *FUNCTION_NAME = "setVideoTimeInterval";
+
+    interval = std::max(interval, std::chrono::milliseconds(0));
+
+    if (interval == m_videoTimeUpdateInterval)
+    {
+        return;
+    }
+
+    m_videoTimeUpdateInterval = interval;
+
+    // a player instance which has not been created yet picks the interval up from its configuration
+    if (!m_playerInstanceCreated)
+    {
+        return;
+    }
+
+    yi::rapidjson::Document command(m_commandPipeline.CreateCommand());
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
+
+    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
+    arguments.PushBack(static_cast<uint64_t>(m_videoTimeUpdateInterval.count()), allocator);
+
+    SendPlayerInstanceCommand(FUNCTION_NAME, std::move(command), std::move(arguments), CYIBitmovinCommandPipeline::CompletionCallback(), CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS);
+}
+
+std::chrono::milliseconds CYIBitmovinVideoPlayerPriv::GetVideoTimeUpdateInterval() const
+{
+    return m_videoTimeUpdateInterval;
+}
+
+void CYIBitmovinVideoPlayerPriv::SendVideoRectangle(const YI_RECT_REL &videoRectangle)
+{
+    static const char *FUNCTION_NAME = "setVideoRectangle";
+
+    m_lastVideoRectangleKeyframeTime = std::chrono::steady_clock::now();
+
+    yi::rapidjson::Document command(m_commandPipeline.CreateCommand());
     yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
 
     yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
@@ -162,83 +320,77 @@ void CYIBitmovinVideoPlayerPriv::SetVideoRectangle(const YI_RECT_REL &videoRecta
     arguments.PushBack(videoRectangle.width, allocator);
     arguments.PushBack(videoRectangle.height, allocator);
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
+    // when keyframes are spaced out, the JavaScript player interpolates towards each one over the keyframe interval
+    arguments.PushBack(static_cast<uint64_t>(m_videoRectangleKeyframeInterval.count()), allocator);
 
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+    // only the latest rectangle from each update tick is sent, and no response is awaited since a misplaced video rectangle is not a playback error
+    m_commandPipeline.SendLatest(CYIBitmovinCommandPipeline::Target::Instance, FUNCTION_NAME, std::move(command), std::move(arguments));
+}
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "SetVideoRectangle did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
-        }
-    }
+void CYIBitmovinVideoPlayerPriv::OnVideoRectangleKeyframeTimerTimedOut()
+{
+    m_videoRectangleKeyframePending = false;
+
+    SendVideoRectangle(m_previousVideoRectangle);
 }
 
 void CYIBitmovinVideoPlayerPriv::Init()
 {
     CreatePlayerInstance();
     InitializePlayerInstance();
+
+    if (!s_capabilityMatrixRevalidated && !s_pCapabilityProbeOwner)
+    {
+        ProbeCapabilities();
+    }
 }
 
 void CYIBitmovinVideoPlayerPriv::CreatePlayerInstance()
 {
     static const char *FUNCTION_NAME = "createInstance";
 
-    yi::rapidjson::Document command(yi::rapidjson::kObjectType);
+    yi::rapidjson::Document command(m_commandPipeline.CreateCommand());
     yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
 
     yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
 
-    arguments.PushBack(m_playerConfiguration, allocator);
+    yi::rapidjson::Value playerConfigurationValue(m_playerConfiguration, allocator);
+
+    if (playerConfigurationValue.IsObject())
+    {
+        playerConfigurationValue.RemoveMember(PLAYER_CONFIGURATION_VIDEO_TIME_INTERVAL_ATTRIBUTE_NAME);
+        playerConfigurationValue.AddMember(yi::rapidjson::StringRef(PLAYER_CONFIGURATION_VIDEO_TIME_INTERVAL_ATTRIBUTE_NAME), yi::rapidjson::Value(static_cast<uint64_t>(m_videoTimeUpdateInterval.count())), allocator);
+
+        playerConfigurationValue.RemoveMember(PLAYER_CONFIGURATION_INSTANCE_ID_ATTRIBUTE_NAME);
+        playerConfigurationValue.AddMember(yi::rapidjson::StringRef(PLAYER_CONFIGURATION_INSTANCE_ID_ATTRIBUTE_NAME), yi::rapidjson::Value(m_instanceId), allocator);
+    }
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallStaticPlayerFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
+    arguments.PushBack(playerConfigurationValue, allocator);
 
-    YI_ASSERT(messageSent, LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
+    m_playerInstanceCreated = true;
 
-    bool valueAssigned = false;
-    CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+    ConsumePlayerPrewarm();
 
-    YI_ASSERT(valueAssigned, LOG_TAG, "Failed to create Bitmovin video player instance, no response received from web messaging bridge!");
-    YI_ASSERT(!response.HasError(), LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
+    // note: queued so that the player instance creation shares a bridge message with the rest of the startup commands
+    SendStaticPlayerCommand(FUNCTION_NAME, std::move(command), std::move(arguments), [](const CYIBitmovinCommandPipeline::Result &result) {
+        YI_ASSERT(result.success, LOG_TAG, "Failed to create Bitmovin video player instance: %s", result.errorMessage.GetData());
+    });
 }
 
 void CYIBitmovinVideoPlayerPriv::InitializePlayerInstance()
 {
     static const char *FUNCTION_NAME = "initialize";
 
-    yi::rapidjson::Document command(yi::rapidjson::kObjectType);
-
-    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
-
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
-
-    YI_ASSERT(messageSent, LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-
-    bool valueAssigned = false;
-    CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
-
-    YI_ASSERT(valueAssigned, LOG_TAG, "Failed to initialize Bitmovin video player instance, no response received from web messaging bridge!");
-    YI_ASSERT(!response.HasError(), LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
+    SendPlayerInstanceCommand(FUNCTION_NAME, m_commandPipeline.CreateCommand(), yi::rapidjson::Value(yi::rapidjson::kArrayType), [](const CYIBitmovinCommandPipeline::Result &result) {
+        YI_ASSERT(result.success, LOG_TAG, "Failed to initialize Bitmovin video player instance: %s", result.errorMessage.GetData());
+    });
 }
 
 void CYIBitmovinVideoPlayerPriv::DestroyPlayerInstance()
 {
     static const char *FUNCTION_NAME = "destroy";
 
-    CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME);
+    CallPlayerFunction(CYIBitmovinBridgeTransport::Target::Instance, FUNCTION_NAME, yi::rapidjson::Document(), yi::rapidjson::Value(yi::rapidjson::kArrayType));
 }
 
 bool CYIBitmovinVideoPlayerPriv::ConvertValueToTrackInfo(const yi::rapidjson::Value &trackValue, CYIAbstractVideoPlayer::TrackInfo &trackData)
@@ -311,76 +463,135 @@ bool CYIBitmovinVideoPlayerPriv::ConvertValueToTrackInfo(const yi::rapidjson::Va
     return true;
 }
 
-uint64_t CYIBitmovinVideoPlayerPriv::RegisterEventHandler(const CYIString &eventName, CYIWebMessagingBridge::EventCallback &&eventCallback)
-{
-    yi::rapidjson::Document filter(yi::rapidjson::kObjectType);
-    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = filter.GetAllocator();
-
-    yi::rapidjson::Value contextNameValue(VIDEO_PLAYER_CLASS_NAME, allocator);
-    filter.AddMember(yi::rapidjson::StringRef(CYIWebMessagingBridge::EVENT_CONTEXT_ATTRIBUTE_NAME), contextNameValue, allocator);
+void CYIBitmovinVideoPlayerPriv::AddEventHandlers()
+{
+    static const struct
+    {
+        const char *pEventName;
+        void (CYIBitmovinVideoPlayerPriv::*pEventHandler)(const yi::rapidjson::Value &);
+    } EVENT_HANDLERS[] = {
+        { "bitrateChanged", &CYIBitmovinVideoPlayerPriv::OnBitrateChanged },
+        { "bufferingStateChanged", &CYIBitmovinVideoPlayerPriv::OnBufferingStateChanged },
+        { "liveStatus", &CYIBitmovinVideoPlayerPriv::OnLiveStatusUpdated },
+        { "playerError", &CYIBitmovinVideoPlayerPriv::OnPlayerErrorThrown },
+        { "audioTracksChanged", &CYIBitmovinVideoPlayerPriv::OnAudioTracksChanged },
+        { "videoDurationChanged", &CYIBitmovinVideoPlayerPriv::OnVideoDurationChanged },
+        { "videoTimeChanged", &CYIBitmovinVideoPlayerPriv::OnVideoTimeChanged },
+        { "stateChanged", &CYIBitmovinVideoPlayerPriv::OnStateChanged },
+        { "textTracksChanged", &CYIBitmovinVideoPlayerPriv::OnTextTracksChanged },
+        { "metadataAvailable", &CYIBitmovinVideoPlayerPriv::OnMetadataAvailable },
+        { "seekCompleted", &CYIBitmovinVideoPlayerPriv::OnSeekCompleted },
+        { "activeAudioTrackChanged", &CYIBitmovinVideoPlayerPriv::OnActiveAudioTrackChanged },
+        { "activeTextTrackChanged", &CYIBitmovinVideoPlayerPriv::OnActiveTextTrackChanged },
+        { "textTrackStatusChanged", &CYIBitmovinVideoPlayerPriv::OnTextTrackStatusChanged },
+        { "muteStatusChanged", &CYIBitmovinVideoPlayerPriv::OnMuteStatusChanged },
+        { "stateSnapshot", &CYIBitmovinVideoPlayerPriv::OnStateSnapshot }
+    };
 
-    yi::rapidjson::Value eventNameValue(eventName.GetData(), allocator);
-    filter.AddMember(yi::rapidjson::StringRef(CYIWebMessagingBridge::EVENT_NAME_ATTRIBUTE_NAME), eventNameValue, allocator);
+    for (const auto &eventHandler : EVENT_HANDLERS)
+    {
+        m_eventDispatcher.AddHandler(eventHandler.pEventName, std::bind(eventHandler.pEventHandler, this, std::placeholders::_1));
+    }
+}
 
-    return CYIWebBridgeLocator::GetWebMessagingBridge()->RegisterEventHandler(std::move(filter), std::move(eventCallback));
+void CYIBitmovinVideoPlayerPriv::RegisterEventHandlers()
+{
+    if (!m_eventDispatcher.Register())
+    {
+        YI_LOGE(LOG_TAG, "Failed to register %s event handlers.", VIDEO_PLAYER_CLASS_NAME);
+    }
 }
 
-void CYIBitmovinVideoPlayerPriv::UnregisterEventHandler(uint64_t &eventHandlerId)
+void CYIBitmovinVideoPlayerPriv::UnregisterEventHandlers()
 {
-    CYIWebBridgeLocator::GetWebMessagingBridge()->UnregisterEventHandler(eventHandlerId);
-    eventHandlerId = 0;
+    m_eventDispatcher.Unregister();
 }
 
-void CYIBitmovinVideoPlayerPriv::RegisterEventHandlers()
+bool CYIBitmovinVideoPlayerPriv::CallPlayerFunction(CYIBitmovinBridgeTransport::Target target, const char *pFunctionName, yi::rapidjson::Document &&message, yi::rapidjson::Value &&playerFunctionArgumentsValue) const
 {
-    if (m_messageHandlersRegistered)
+    // queued commands must reach the player before any direct function call to preserve ordering
+    m_commandPipeline.Flush();
+
+    if (!CYIBitmovinBridgeScheduler::GetInstance().Send(CYIBitmovinBridgeScheduler::MessageClass::Control, target, VIDEO_PLAYER_CLASS_NAME, m_instanceAccessorName.GetData(), pFunctionName, std::move(message), std::move(playerFunctionArgumentsValue)))
     {
-        return;
+        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", pFunctionName);
+        return false;
     }
 
-    m_bitrateChangedEventHandlerId = RegisterEventHandler("bitrateChanged", std::bind(&CYIBitmovinVideoPlayerPriv::OnBitrateChanged, this, std::placeholders::_1));
-    m_bufferingStateChangedEventHandlerId = RegisterEventHandler("bufferingStateChanged", std::bind(&CYIBitmovinVideoPlayerPriv::OnBufferingStateChanged, this, std::placeholders::_1));
-    m_liveStatusEventHandlerId = RegisterEventHandler("liveStatus", std::bind(&CYIBitmovinVideoPlayerPriv::OnLiveStatusUpdated, this, std::placeholders::_1));
-    m_playerErrorEventHandlerId = RegisterEventHandler("playerError", std::bind(&CYIBitmovinVideoPlayerPriv::OnPlayerErrorThrown, this, std::placeholders::_1));
-    m_audioTracksChangedEventHandlerId = RegisterEventHandler("audioTracksChanged", std::bind(&CYIBitmovinVideoPlayerPriv::OnAudioTracksChanged, this, std::placeholders::_1));
-    m_videoDurationChangedEventHandlerId = RegisterEventHandler("videoDurationChanged", std::bind(&CYIBitmovinVideoPlayerPriv::OnVideoDurationChanged, this, std::placeholders::_1));
-    m_videoTimeChangedEventHandlerId = RegisterEventHandler("videoTimeChanged", std::bind(&CYIBitmovinVideoPlayerPriv::OnVideoTimeChanged, this, std::placeholders::_1));
-    m_stateChangedEventHandlerId = RegisterEventHandler("stateChanged", std::bind(&CYIBitmovinVideoPlayerPriv::OnStateChanged, this, std::placeholders::_1));
-    m_textTracksChangedEventHandlerId = RegisterEventHandler("textTracksChanged", std::bind(&CYIBitmovinVideoPlayerPriv::OnTextTracksChanged, this, std::placeholders::_1));
-    m_metadataAvailableEventHandlerId = RegisterEventHandler("metadataAvailable", std::bind(&CYIBitmovinVideoPlayerPriv::OnMetadataAvailable, this, std::placeholders::_1));
-
-    m_messageHandlersRegistered = true;
+    return true;
 }
 
-void CYIBitmovinVideoPlayerPriv::UnregisterEventHandlers()
+bool CYIBitmovinVideoPlayerPriv::CallPlayerFunctionAndWait(CYIBitmovinBridgeTransport::Target target, const char *pFunctionName, yi::rapidjson::Document &&message, yi::rapidjson::Value &&playerFunctionArgumentsValue, const std::function<void(const yi::rapidjson::Value &result)> &resultHandler) const
 {
-    if (!m_messageHandlersRegistered)
+    // queued commands must reach the player before any direct function call to preserve ordering
+    m_commandPipeline.Flush();
+
+    bool succeeded = false;
+    uint64_t timeoutMs = s_latencyRecorder.GetTimeoutMs(pFunctionName, CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS);
+    std::chrono::steady_clock::time_point sendTime = std::chrono::steady_clock::now();
+
+    CYIBitmovinBridgeTransport::CallStatus callStatus = CYIBitmovinBridgeTransport::GetInstance()->CallAndWait(target, VIDEO_PLAYER_CLASS_NAME, m_instanceAccessorName.GetData(), pFunctionName, std::move(message), std::move(playerFunctionArgumentsValue), timeoutMs, [pFunctionName, sendTime, &resultHandler, &succeeded](const CYIBitmovinBridgeTransport::Response &response) {
+        s_latencyRecorder.RecordLatency(pFunctionName, std::chrono::steady_clock::now() - sendTime);
+
+        if (response.hasError)
+        {
+            s_latencyRecorder.RecordError(pFunctionName);
+
+            YI_LOGE(LOG_TAG, "%s", response.errorMessage.GetData());
+        }
+        else if (!response.pResult)
+        {
+            YI_LOGE(LOG_TAG, "%s did not return a result.", pFunctionName);
+        }
+        else
+        {
+            succeeded = true;
+
+            resultHandler(*response.pResult);
+        }
+    });
+
+    if (callStatus == CYIBitmovinBridgeTransport::CallStatus::NotSent)
     {
-        return;
+        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", pFunctionName);
+    }
+    else if (callStatus == CYIBitmovinBridgeTransport::CallStatus::TimedOut)
+    {
+        s_latencyRecorder.RecordTimeout(pFunctionName);
+
+        YI_LOGE(LOG_TAG, "%s did not receive a response from the web messaging bridge!", pFunctionName);
     }
 
-    UnregisterEventHandler(m_bitrateChangedEventHandlerId);
-    UnregisterEventHandler(m_bufferingStateChangedEventHandlerId);
-    UnregisterEventHandler(m_liveStatusEventHandlerId);
-    UnregisterEventHandler(m_playerErrorEventHandlerId);
-    UnregisterEventHandler(m_audioTracksChangedEventHandlerId);
-    UnregisterEventHandler(m_videoDurationChangedEventHandlerId);
-    UnregisterEventHandler(m_videoTimeChangedEventHandlerId);
-    UnregisterEventHandler(m_stateChangedEventHandlerId);
-    UnregisterEventHandler(m_textTracksChangedEventHandlerId);
-    UnregisterEventHandler(m_metadataAvailableEventHandlerId);
+    return succeeded;
+}
+
+bool CYIBitmovinVideoPlayerPriv::SendStaticPlayerCommand(const char *pFunctionName, yi::rapidjson::Document &&message, yi::rapidjson::Value &&playerFunctionArgumentsValue, CYIBitmovinCommandPipeline::CompletionCallback &&completionCallback, uint64_t timeoutMs)
+{
+    return SendPlayerCommand(CYIBitmovinCommandPipeline::Target::Static, pFunctionName, std::move(message), std::move(playerFunctionArgumentsValue), std::move(completionCallback), timeoutMs);
+}
 
-    m_messageHandlersRegistered = false;
+bool CYIBitmovinVideoPlayerPriv::SendPlayerInstanceCommand(const char *pFunctionName)
+{
+    return SendPlayerCommand(CYIBitmovinCommandPipeline::Target::Instance, pFunctionName, m_commandPipeline.CreateCommand(), yi::rapidjson::Value(yi::rapidjson::kArrayType), CYIBitmovinCommandPipeline::CompletionCallback(), CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS);
+}
+
+bool CYIBitmovinVideoPlayerPriv::SendPlayerInstanceCommand(const char *pFunctionName, yi::rapidjson::Document &&message, yi::rapidjson::Value &&playerFunctionArgumentsValue, CYIBitmovinCommandPipeline::CompletionCallback &&completionCallback, uint64_t timeoutMs)
+{
+    return SendPlayerCommand(CYIBitmovinCommandPipeline::Target::Instance, pFunctionName, std::move(message), std::move(playerFunctionArgumentsValue), std::move(completionCallback), timeoutMs);
 }
 
-CYIWebMessagingBridge::FutureResponse CYIBitmovinVideoPlayerPriv::CallStaticPlayerFunction(yi::rapidjson::Document &&message, const CYIString &functionName, yi::rapidjson::Value &&playerFunctionArgumentsValue, bool *pMessageSent) const
+bool CYIBitmovinVideoPlayerPriv::SendPlayerCommand(CYIBitmovinCommandPipeline::Target target, const char *pFunctionName, yi::rapidjson::Document &&message, yi::rapidjson::Value &&playerFunctionArgumentsValue, CYIBitmovinCommandPipeline::CompletionCallback &&completionCallback, uint64_t timeoutMs)
 {
-    return CYIWebBridgeLocator::GetWebMessagingBridge()->CallStaticFunctionWithArgs(std::move(message), VIDEO_PLAYER_CLASS_NAME, functionName, std::move(playerFunctionArgumentsValue), pMessageSent);
+    // failures are reported through the pipeline's failure callback rather than by wrapping the completion callback, which would allocate
+    return m_commandPipeline.Send(target, pFunctionName, std::move(message), std::move(playerFunctionArgumentsValue), std::move(completionCallback), timeoutMs, true);
 }
 
-CYIWebMessagingBridge::FutureResponse CYIBitmovinVideoPlayerPriv::CallPlayerInstanceFunction(yi::rapidjson::Document &&message, const CYIString &functionName, yi::rapidjson::Value &&playerFunctionArgumentsValue, bool *pMessageSent) const
+void CYIBitmovinVideoPlayerPriv::NotifyCommandFailed(const CYIString &functionName, const CYIBitmovinCommandPipeline::Result &result)
 {
-    return CYIWebBridgeLocator::GetWebMessagingBridge()->CallInstanceFunctionWithArgs(std::move(message), VIDEO_PLAYER_CLASS_NAME, VIDEO_PLAYER_INSTANCE_ACCESSOR_NAME, functionName, std::move(playerFunctionArgumentsValue), yi::rapidjson::Value(yi::rapidjson::kArrayType), pMessageSent);
+    CYIAbstractVideoPlayer::Error error;
+    error.errorCode = CYIAbstractVideoPlayer::ErrorCode::PlaybackError;
+    error.message = result.errorMessage.IsNotEmpty() ? result.errorMessage : CYIString("Player command " + functionName + " failed.");
+    m_pPub->NotifyErrorOccurred(error);
 }
 
 void CYIBitmovinVideoPlayerPriv::OnBitrateChanged(const yi::rapidjson::Value &eventValue)
@@ -412,6 +623,10 @@ void CYIBitmovinVideoPlayerPriv::OnBitrateChanged(const yi::rapidjson::Value &ev
         return;
     }
 
+    bool audioBitrateChanged = false;
+    bool videoBitrateChanged = false;
+    bool totalBitrateChanged = false;
+
     if (eventDataValue.HasMember(INITIAL_AUDIO_BITRATE_ATTRIBUTE_NAME) || eventDataValue.HasMember(CURRENT_AUDIO_BITRATE_ATTRIBUTE_NAME))
     {
         CYIParsingError initialAudioBitrateParsingError;
@@ -428,7 +643,7 @@ void CYIBitmovinVideoPlayerPriv::OnBitrateChanged(const yi::rapidjson::Value &ev
         CYIParsingError currentAudioBitrateParsingError;
         float currentAudioBitrateKbps = -1;
 
-        CYIRapidJSONUtility::GetFloatField(&eventDataValue, CURRENT_AUDIO_BITRATE_ATTRIBUTE_NAME, &m_currentAudioBitrateKbps, currentAudioBitrateParsingError);
+        CYIRapidJSONUtility::GetFloatField(&eventDataValue, CURRENT_AUDIO_BITRATE_ATTRIBUTE_NAME, &currentAudioBitrateKbps, currentAudioBitrateParsingError);
 
         if (currentAudioBitrateParsingError.HasError())
         {
@@ -441,10 +656,7 @@ void CYIBitmovinVideoPlayerPriv::OnBitrateChanged(const yi::rapidjson::Value &ev
         m_initialAudioBitrateKbps = initialAudioBitrateKbps;
         m_currentAudioBitrateKbps = currentAudioBitrateKbps;
 
-        if (!YI_FLOAT_EQUAL(previousAudioBitrateKbps, m_currentAudioBitrateKbps))
-        {
-            m_pPub->AudioBitrateChanged(m_currentAudioBitrateKbps);
-        }
+        audioBitrateChanged = !YI_FLOAT_EQUAL(previousAudioBitrateKbps, m_currentAudioBitrateKbps);
     }
 
     if (eventDataValue.HasMember(INITIAL_VIDEO_BITRATE_ATTRIBUTE_NAME) || eventDataValue.HasMember(CURRENT_VIDEO_BITRATE_ATTRIBUTE_NAME))
@@ -476,10 +688,9 @@ void CYIBitmovinVideoPlayerPriv::OnBitrateChanged(const yi::rapidjson::Value &ev
         m_initialVideoBitrateKbps = initialVideoBitrateKbps;
         m_currentVideoBitrateKbps = currentVideoBitrateKbps;
 
-        if (!YI_FLOAT_EQUAL(previousVideoBitrateKbps, m_currentVideoBitrateKbps))
-        {
-            m_pPub->VideoBitrateChanged(m_currentVideoBitrateKbps);
-        }
+        m_qoeMetrics.SetVideoBitrateKbps(m_currentVideoBitrateKbps);
+
+        videoBitrateChanged = !YI_FLOAT_EQUAL(previousVideoBitrateKbps, m_currentVideoBitrateKbps);
     }
 
     if (eventDataValue.HasMember(INITIAL_TOTAL_BITRATE_ATTRIBUTE_NAME) || eventDataValue.HasMember(CURRENT_TOTAL_BITRATE_ATTRIBUTE_NAME))
@@ -511,10 +722,26 @@ void CYIBitmovinVideoPlayerPriv::OnBitrateChanged(const yi::rapidjson::Value &ev
         m_initialTotalBitrateKbps = initialTotalBitrateKbps;
         m_currentTotalBitrateKbps = currentTotalBitrateKbps;
 
-        if (!YI_FLOAT_EQUAL(previousTotalBitrateKbps, m_currentTotalBitrateKbps))
-        {
-            m_pPub->TotalBitrateChanged(m_currentTotalBitrateKbps);
-        }
+        totalBitrateChanged = !YI_FLOAT_EQUAL(previousTotalBitrateKbps, m_currentTotalBitrateKbps);
+    }
+
+    // the statistics are published before the signals are emitted, so that handlers which read them see the new bitrates
+    PublishStatistics();
+    m_bitrateHistory.AddSample(m_currentVideoBitrateKbps, m_currentAudioBitrateKbps, m_currentTotalBitrateKbps, m_bufferLengthMs);
+
+    if (audioBitrateChanged)
+    {
+        m_pPub->AudioBitrateChanged(m_currentAudioBitrateKbps);
+    }
+
+    if (videoBitrateChanged)
+    {
+        m_pPub->VideoBitrateChanged(m_currentVideoBitrateKbps);
+    }
+
+    if (totalBitrateChanged)
+    {
+        m_pPub->TotalBitrateChanged(m_currentTotalBitrateKbps);
     }
 }
 
@@ -536,6 +763,9 @@ void CYIBitmovinVideoPlayerPriv::OnBufferingStateChanged(const yi::rapidjson::Va
         return;
     }
 
+    UpdatePlayheadClock();
+    m_qoeMetrics.SetBuffering(m_buffering);
+
     if (m_buffering)
     {
         CYIAbstractVideoPlayer::PlayerState currentState = m_pPub->GetPlayerState();
@@ -578,6 +808,11 @@ void CYIBitmovinVideoPlayerPriv::OnLiveStatusUpdated(const yi::rapidjson::Value
         YI_LOGE(LOG_TAG, "OnLiveStatusUpdated event value is does not contain a valid boolean value for '%s'. JSON string for event value: %s", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
         return;
     }
+
+    // the playhead of a live stream is not bounded by the duration of its seekable window
+    m_playheadClock.SetDurationMs(m_isLive ? 0 : m_durationMs);
+
+    PublishStatistics();
 }
 
 void CYIBitmovinVideoPlayerPriv::OnPlayerErrorThrown(const yi::rapidjson::Value &eventValue)
@@ -707,6 +942,7 @@ void CYIBitmovinVideoPlayerPriv::OnVideoDurationChanged(const yi::rapidjson::Val
     }
 
     m_durationMs = static_cast<uint64_t>(durationSeconds * 1000.0f);
+    m_playheadClock.SetDurationMs(m_isLive ? 0 : m_durationMs);
 
     m_pPub->NotifyDurationChanged(m_durationMs);
 }
@@ -722,17 +958,32 @@ void CYIBitmovinVideoPlayerPriv::OnVideoTimeChanged(const yi::rapidjson::Value &
         return;
     }
 
-    if (!eventValue.HasMember(CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME))
+    yi::rapidjson::Value::ConstMemberIterator eventDataIterator = eventValue.FindMember(CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME);
+
+    if (eventDataIterator == eventValue.MemberEnd())
     {
         YI_LOGE(LOG_TAG, "OnVideoTimeChanged event value is missing '%s' attribute!", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME);
         return;
     }
 
-    const yi::rapidjson::Value &eventDataValue = eventValue[CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME];
+    const yi::rapidjson::Value &eventDataValue = eventDataIterator->value;
+
+    // time updates are normally sent as a packed array with a fixed layout, the object encoding is only used as a fallback
+    if (eventDataValue.IsArray())
+    {
+        if (eventDataValue.Size() <= VIDEO_TIME_BUFFER_LENGTH_INDEX || !eventDataValue[VIDEO_TIME_CURRENT_TIME_INDEX].IsNumber() || !eventDataValue[VIDEO_TIME_BUFFER_LENGTH_INDEX].IsNumber())
+        {
+            YI_LOGE(LOG_TAG, "OnVideoTimeChanged encountered an invalid packed event data value. JSON string for event data: %s", CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
+            return;
+        }
+
+        UpdateVideoTime(eventDataValue[VIDEO_TIME_CURRENT_TIME_INDEX].GetDouble(), eventDataValue[VIDEO_TIME_BUFFER_LENGTH_INDEX].GetFloat());
+        return;
+    }
 
     if (!eventDataValue.IsObject())
     {
-        YI_LOGE(LOG_TAG, "OnVideoTimeChanged expected an object type for event '%s', received %s. JSON string for event '%s': %s", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::TypeToString(eventDataValue.GetType()).GetData(), CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
+        YI_LOGE(LOG_TAG, "OnVideoTimeChanged expected an object or array type for event '%s', received %s. JSON string for event '%s': %s", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::TypeToString(eventDataValue.GetType()).GetData(), CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
         return;
     }
 
@@ -744,36 +995,49 @@ void CYIBitmovinVideoPlayerPriv::OnVideoTimeChanged(const yi::rapidjson::Value &
 
     const yi::rapidjson::Value &currentTimeValue = eventDataValue[CURRENT_TIME_ATTRIBUTE_NAME];
 
-    double currentTimeSeconds;
-
     if (!currentTimeValue.IsNumber())
     {
         YI_LOGE(LOG_TAG, "OnVideoTimeChanged encountered an invalid number value for event data '%s'. JSON string for event data: %s", CURRENT_TIME_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
         return;
     }
 
-    currentTimeSeconds = currentTimeValue.GetDouble();
+    float bufferLengthMs = m_bufferLengthMs;
+
+    CYIParsingError parsingError;
+
+    CYIRapidJSONUtility::GetFloatField(&eventDataValue, BUFFER_LENGTH_ATTRIBUTE_NAME, &bufferLengthMs, parsingError);
+
+    if (parsingError.HasError() && parsingError.GetParsingErrorCode() != CYIParsingError::ErrorType::DataFieldMissing)
+    {
+        YI_LOGE(LOG_TAG, "OnVideoTimeChanged encountered an invalid float value for event data '%s'. JSON string for event data: %s", BUFFER_LENGTH_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
+    }
+
+    UpdateVideoTime(currentTimeValue.GetDouble(), bufferLengthMs);
+}
 
+void CYIBitmovinVideoPlayerPriv::UpdateVideoTime(double currentTimeSeconds, float bufferLengthMs)
+{
     if(currentTimeSeconds < 0) {
-        YI_LOGE(LOG_TAG, "OnVideoTimeChanged encountered a negative number value for event data '%s'. JSON string for event data: %s", CURRENT_TIME_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
+        YI_LOGE(LOG_TAG, "OnVideoTimeChanged encountered a negative current time value: %f", currentTimeSeconds);
         return;
     }
 
     m_currentTimeMs = static_cast<uint64_t>(currentTimeSeconds * 1000.0f);
+    m_bufferLengthMs = bufferLengthMs;
 
-    if (m_pPub->GetPlayerState() == CYIAbstractVideoPlayer::PlaybackState::Paused || m_pPub->GetPlayerState() == CYIAbstractVideoPlayer::PlaybackState::Buffering)
+    PublishStatistics();
+    m_qoeMetrics.OnVideoTimeUpdated();
+    m_bitrateHistory.AddSample(m_currentVideoBitrateKbps, m_currentAudioBitrateKbps, m_currentTotalBitrateKbps, m_bufferLengthMs);
+
+    // while a seek is in flight the playhead is held at the seek target, samples from before the seek would make it jump back
+    if (!m_seekInFlight)
     {
-        m_pPub->UpdateCurrentTime();
+        m_playheadClock.AddSample(m_currentTimeMs);
     }
 
-    CYIParsingError parsingError;
-
-    CYIRapidJSONUtility::GetFloatField(&eventDataValue, BUFFER_LENGTH_ATTRIBUTE_NAME, &m_bufferLengthMs, parsingError);
-
-    if (parsingError.HasError() && parsingError.GetParsingErrorCode() != CYIParsingError::ErrorType::DataFieldMissing)
+    if (m_pPub->GetPlayerState() == CYIAbstractVideoPlayer::PlaybackState::Paused || m_pPub->GetPlayerState() == CYIAbstractVideoPlayer::PlaybackState::Buffering)
     {
-        YI_LOGE(LOG_TAG, "OnVideoTimeChanged encountered an invalid float value for event data '%s'. JSON string for event data: %s", BUFFER_LENGTH_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
-        return;
+        m_pPub->UpdateCurrentTime();
     }
 }
 
@@ -841,6 +1105,10 @@ void CYIBitmovinVideoPlayerPriv::OnStateChanged(const yi::rapidjson::Value &even
             break;
         }
     };
+
+    m_playing = state == PlayerState::Playing;
+    UpdatePlayheadClock();
+    m_qoeMetrics.SetPlaying(m_playing);
 }
 
 void CYIBitmovinVideoPlayerPriv::OnTextTracksChanged(const yi::rapidjson::Value &eventValue)
@@ -890,79 +1158,249 @@ void CYIBitmovinVideoPlayerPriv::OnTextTracksChanged(const yi::rapidjson::Value
     }
 }
 
-void CYIBitmovinVideoPlayerPriv::OnMetadataAvailable(const yi::rapidjson::Value &eventValue)
+void CYIBitmovinVideoPlayerPriv::OnActiveAudioTrackChanged(const yi::rapidjson::Value &eventValue)
 {
-    static const char *IDENTIFIER_ATTRIBUTE_NAME = "identifier";
-    static const char *VALUE_ATTRIBUTE_NAME = "value";
-    static const char *TIMESTAMP_ATTRIBUTE_NAME = "timestamp";
-    static const char *DURATION_ATTRIBUTE_NAME = "durationMs";
-
     if (!eventValue.IsObject())
     {
-        YI_LOGE(LOG_TAG, "OnMetadataAvailable encountered an invalid event value, expected object, received %s. JSON string for event: %s", CYIRapidJSONUtility::TypeToString(eventValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        YI_LOGE(LOG_TAG, "OnActiveAudioTrackChanged encountered an invalid event value, expected object, received %s. JSON string for event: %s", CYIRapidJSONUtility::TypeToString(eventValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
         return;
     }
 
     if (!eventValue.HasMember(CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME))
     {
-        YI_LOGE(LOG_TAG, "OnMetadataAvailable event value is missing '%s' attribute!", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME);
+        YI_LOGE(LOG_TAG, "OnActiveAudioTrackChanged event value is missing '%s' attribute!", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME);
         return;
     }
 
-    const yi::rapidjson::Value &eventDataValue = eventValue[CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME];
+    UpdateActiveAudioTrack(eventValue[CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME]);
+}
 
-    if (!eventDataValue.IsObject())
+void CYIBitmovinVideoPlayerPriv::OnActiveTextTrackChanged(const yi::rapidjson::Value &eventValue)
+{
+    if (!eventValue.IsObject())
     {
-        YI_LOGE(LOG_TAG, "OnMetadataAvailable expected an object type for event '%s', received %s. JSON string for event '%s': %s", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::TypeToString(eventDataValue.GetType()).GetData(), CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
+        YI_LOGE(LOG_TAG, "OnActiveTextTrackChanged encountered an invalid event value, expected object, received %s. JSON string for event: %s", CYIRapidJSONUtility::TypeToString(eventValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
         return;
     }
 
-    CYIAbstractVideoPlayer::TimedMetadata timedMetadata;
-
-    CYIParsingError parsingError;
-
-    CYIRapidJSONUtility::GetStringField(&eventDataValue, IDENTIFIER_ATTRIBUTE_NAME, timedMetadata.identifier, parsingError);
-
-    if (parsingError.HasError() || timedMetadata.identifier.IsEmpty())
+    if (!eventValue.HasMember(CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME))
     {
-        YI_LOGE(LOG_TAG, "OnMetadataAvailable encountered an invalid string value for event data '%s'. JSON string for event data: %s", IDENTIFIER_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
+        YI_LOGE(LOG_TAG, "OnActiveTextTrackChanged event value is missing '%s' attribute!", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME);
         return;
     }
 
-    CYIRapidJSONUtility::GetStringField(&eventDataValue, VALUE_ATTRIBUTE_NAME, timedMetadata.value, parsingError);
+    UpdateActiveTextTrack(eventValue[CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME]);
+}
 
-    if (parsingError.HasError())
+void CYIBitmovinVideoPlayerPriv::OnTextTrackStatusChanged(const yi::rapidjson::Value &eventValue)
+{
+    if (!eventValue.IsObject())
     {
-        YI_LOGE(LOG_TAG, "OnMetadataAvailable encountered an invalid string value for event data '%s'. JSON string for event data: %s", VALUE_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
+        YI_LOGE(LOG_TAG, "OnTextTrackStatusChanged encountered an invalid event value, expected object, received %s. JSON string for event: %s", CYIRapidJSONUtility::TypeToString(eventValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
         return;
     }
 
-    uint64_t timestamp = 0;
-
-    if (!eventDataValue.HasMember(TIMESTAMP_ATTRIBUTE_NAME))
-    {
-        YI_LOGE(LOG_TAG, "OnMetadataAvailable event data value is missing '%s' attribute!", TIMESTAMP_ATTRIBUTE_NAME);
-        return;
-    }
+    CYIParsingError parsingError;
 
-    const yi::rapidjson::Value &timestampValue = eventDataValue[TIMESTAMP_ATTRIBUTE_NAME];
+    CYIRapidJSONUtility::GetBooleanField(&eventValue, CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, &m_textTrackEnabled, parsingError);
 
-    if (timestampValue.IsUint64())
+    if (parsingError.HasError())
     {
-        timestamp = timestampValue.GetUint64();
+        YI_LOGE(LOG_TAG, "OnTextTrackStatusChanged event value does not contain a valid boolean value for '%s'. JSON string for event value: %s", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
     }
-    else if (timestampValue.IsDouble()) {
-        timestamp = static_cast<int64_t>(timestampValue.GetDouble());
-    }
-    else
+}
+
+void CYIBitmovinVideoPlayerPriv::OnMuteStatusChanged(const yi::rapidjson::Value &eventValue)
+{
+    if (!eventValue.IsObject())
     {
-        YI_LOGE(LOG_TAG, "OnMetadataAvailable encountered an invalid number value for event data '%s'. JSON string for event data: %s", TIMESTAMP_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(timestampValue).GetData());
+        YI_LOGE(LOG_TAG, "OnMuteStatusChanged encountered an invalid event value, expected object, received %s. JSON string for event: %s", CYIRapidJSONUtility::TypeToString(eventValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
         return;
     }
 
-    timedMetadata.timestamp = std::chrono::microseconds{std::chrono::milliseconds{timestamp}};
+    CYIParsingError parsingError;
 
-    uint64_t durationMs = 0;
+    CYIRapidJSONUtility::GetBooleanField(&eventValue, CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, &m_muted, parsingError);
+
+    if (parsingError.HasError())
+    {
+        YI_LOGE(LOG_TAG, "OnMuteStatusChanged event value does not contain a valid boolean value for '%s'. JSON string for event value: %s", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+    }
+}
+
+void CYIBitmovinVideoPlayerPriv::OnStateSnapshot(const yi::rapidjson::Value &eventValue)
+{
+    static const char *VERSION_ATTRIBUTE_NAME = "version";
+    static const char *NICKNAME_ATTRIBUTE_NAME = "nickname";
+    static const char *MUTED_ATTRIBUTE_NAME = "muted";
+    static const char *TEXT_TRACK_ENABLED_ATTRIBUTE_NAME = "textTrackEnabled";
+    static const char *ACTIVE_AUDIO_TRACK_ATTRIBUTE_NAME = "activeAudioTrack";
+    static const char *ACTIVE_TEXT_TRACK_ATTRIBUTE_NAME = "activeTextTrack";
+
+    if (!eventValue.IsObject())
+    {
+        YI_LOGE(LOG_TAG, "OnStateSnapshot encountered an invalid event value, expected object, received %s. JSON string for event: %s", CYIRapidJSONUtility::TypeToString(eventValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        return;
+    }
+
+    if (!eventValue.HasMember(CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME))
+    {
+        YI_LOGE(LOG_TAG, "OnStateSnapshot event value is missing '%s' attribute!", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME);
+        return;
+    }
+
+    const yi::rapidjson::Value &eventDataValue = eventValue[CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME];
+
+    if (!eventDataValue.IsObject())
+    {
+        YI_LOGE(LOG_TAG, "OnStateSnapshot expected an object type for event '%s', received %s. JSON string for event '%s': %s", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::TypeToString(eventDataValue.GetType()).GetData(), CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
+        return;
+    }
+
+    if (!eventDataValue.HasMember(VERSION_ATTRIBUTE_NAME) || !eventDataValue[VERSION_ATTRIBUTE_NAME].IsUint64())
+    {
+        YI_LOGE(LOG_TAG, "OnStateSnapshot event data does not contain a valid '%s' attribute! JSON string for event data: %s", VERSION_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
+        return;
+    }
+
+    uint64_t version = eventDataValue[VERSION_ATTRIBUTE_NAME].GetUint64();
+
+    // snapshots are versioned so that a stale snapshot never overwrites state mirrored from a newer one
+    if (version <= m_stateSnapshotVersion)
+    {
+        return;
+    }
+
+    m_stateSnapshotVersion = version;
+
+    if (eventDataValue.HasMember(NICKNAME_ATTRIBUTE_NAME))
+    {
+        const yi::rapidjson::Value &nicknameValue = eventDataValue[NICKNAME_ATTRIBUTE_NAME];
+        m_nickname = nicknameValue.IsString() ? CYIString(nicknameValue.GetString()) : CYIString::EmptyString();
+    }
+
+    if (eventDataValue.HasMember(MUTED_ATTRIBUTE_NAME) && eventDataValue[MUTED_ATTRIBUTE_NAME].IsBool())
+    {
+        m_muted = eventDataValue[MUTED_ATTRIBUTE_NAME].GetBool();
+    }
+
+    if (eventDataValue.HasMember(TEXT_TRACK_ENABLED_ATTRIBUTE_NAME) && eventDataValue[TEXT_TRACK_ENABLED_ATTRIBUTE_NAME].IsBool())
+    {
+        m_textTrackEnabled = eventDataValue[TEXT_TRACK_ENABLED_ATTRIBUTE_NAME].GetBool();
+    }
+
+    if (eventDataValue.HasMember(ACTIVE_AUDIO_TRACK_ATTRIBUTE_NAME))
+    {
+        UpdateActiveAudioTrack(eventDataValue[ACTIVE_AUDIO_TRACK_ATTRIBUTE_NAME]);
+    }
+
+    if (eventDataValue.HasMember(ACTIVE_TEXT_TRACK_ATTRIBUTE_NAME))
+    {
+        UpdateActiveTextTrack(eventDataValue[ACTIVE_TEXT_TRACK_ATTRIBUTE_NAME]);
+    }
+}
+
+void CYIBitmovinVideoPlayerPriv::UpdateActiveAudioTrack(const yi::rapidjson::Value &trackValue)
+{
+    CYIAbstractVideoPlayer::AudioTrackInfo audioTrackInfo(0);
+
+    // note: a null track indicates that there is no active audio track
+    if (!trackValue.IsNull() && !ConvertValueToTrackInfo(trackValue, audioTrackInfo))
+    {
+        YI_LOGW(LOG_TAG, "Active audio track data is invalid. JSON string for track data: %s", CYIRapidJSONUtility::CreateStringFromValue(trackValue).GetData());
+        return;
+    }
+
+    m_activeAudioTrack = audioTrackInfo;
+}
+
+void CYIBitmovinVideoPlayerPriv::UpdateActiveTextTrack(const yi::rapidjson::Value &trackValue)
+{
+    CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo textTrackInfo(0);
+
+    // note: a null track indicates that there is no active text track
+    if (!trackValue.IsNull() && !ConvertValueToTrackInfo(trackValue, textTrackInfo))
+    {
+        YI_LOGW(LOG_TAG, "Active text track data is invalid. JSON string for track data: %s", CYIRapidJSONUtility::CreateStringFromValue(trackValue).GetData());
+        return;
+    }
+
+    m_activeTextTrack = textTrackInfo;
+}
+
+void CYIBitmovinVideoPlayerPriv::OnMetadataAvailable(const yi::rapidjson::Value &eventValue)
+{
+    static const char *IDENTIFIER_ATTRIBUTE_NAME = "identifier";
+    static const char *VALUE_ATTRIBUTE_NAME = "value";
+    static const char *TIMESTAMP_ATTRIBUTE_NAME = "timestamp";
+    static const char *DURATION_ATTRIBUTE_NAME = "durationMs";
+
+    if (!eventValue.IsObject())
+    {
+        YI_LOGE(LOG_TAG, "OnMetadataAvailable encountered an invalid event value, expected object, received %s. JSON string for event: %s", CYIRapidJSONUtility::TypeToString(eventValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        return;
+    }
+
+    if (!eventValue.HasMember(CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME))
+    {
+        YI_LOGE(LOG_TAG, "OnMetadataAvailable event value is missing '%s' attribute!", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME);
+        return;
+    }
+
+    const yi::rapidjson::Value &eventDataValue = eventValue[CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME];
+
+    if (!eventDataValue.IsObject())
+    {
+        YI_LOGE(LOG_TAG, "OnMetadataAvailable expected an object type for event '%s', received %s. JSON string for event '%s': %s", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::TypeToString(eventDataValue.GetType()).GetData(), CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
+        return;
+    }
+
+    CYIAbstractVideoPlayer::TimedMetadata timedMetadata;
+
+    CYIParsingError parsingError;
+
+    CYIRapidJSONUtility::GetStringField(&eventDataValue, IDENTIFIER_ATTRIBUTE_NAME, timedMetadata.identifier, parsingError);
+
+    if (parsingError.HasError() || timedMetadata.identifier.IsEmpty())
+    {
+        YI_LOGE(LOG_TAG, "OnMetadataAvailable encountered an invalid string value for event data '%s'. JSON string for event data: %s", IDENTIFIER_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
+        return;
+    }
+
+    CYIRapidJSONUtility::GetStringField(&eventDataValue, VALUE_ATTRIBUTE_NAME, timedMetadata.value, parsingError);
+
+    if (parsingError.HasError())
+    {
+        YI_LOGE(LOG_TAG, "OnMetadataAvailable encountered an invalid string value for event data '%s'. JSON string for event data: %s", VALUE_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
+        return;
+    }
+
+    uint64_t timestamp = 0;
+
+    if (!eventDataValue.HasMember(TIMESTAMP_ATTRIBUTE_NAME))
+    {
+        YI_LOGE(LOG_TAG, "OnMetadataAvailable event data value is missing '%s' attribute!", TIMESTAMP_ATTRIBUTE_NAME);
+        return;
+    }
+
+    const yi::rapidjson::Value &timestampValue = eventDataValue[TIMESTAMP_ATTRIBUTE_NAME];
+
+    if (timestampValue.IsUint64())
+    {
+        timestamp = timestampValue.GetUint64();
+    }
+    else if (timestampValue.IsDouble()) {
+        timestamp = static_cast<int64_t>(timestampValue.GetDouble());
+    }
+    else
+    {
+        YI_LOGE(LOG_TAG, "OnMetadataAvailable encountered an invalid number value for event data '%s'. JSON string for event data: %s", TIMESTAMP_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(timestampValue).GetData());
+        return;
+    }
+
+    timedMetadata.timestamp = std::chrono::microseconds{std::chrono::milliseconds{timestamp}};
+
+    uint64_t durationMs = 0;
 
     if (!eventDataValue.HasMember(DURATION_ATTRIBUTE_NAME))
     {
@@ -990,6 +1428,18 @@ void CYIBitmovinVideoPlayerPriv::OnMetadataAvailable(const yi::rapidjson::Value
     MetadataAvailable.Emit(timedMetadata);
 }
 
+void CYIBitmovinVideoPlayerPriv::OnSeekCompleted(const yi::rapidjson::Value &eventValue)
+{
+    YI_UNUSED(eventValue);
+
+    if (!m_seekInFlight)
+    {
+        return;
+    }
+
+    CompleteSeek();
+}
+
 void CYIBitmovinVideoPlayerPriv::AddDRMConfigurationToValue(CYIAbstractVideoPlayer::DRMConfiguration *pDRMConfiguration, yi::rapidjson::Value &value, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator)
 {
     if (!pDRMConfiguration)
@@ -1050,40 +1500,16 @@ CYIString CYIBitmovinVideoPlayerPriv::GetName() const
 
     if (type.IsEmpty())
     {
-        bool messageSent = false;
-        CYIWebMessagingBridge::FutureResponse futureResponse = CallStaticPlayerFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
-
-        if (!messageSent)
-        {
-            YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-        }
-        else
-        {
-            bool valueAssigned = false;
-            CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
-
-            if (!valueAssigned)
+        CallPlayerFunctionAndWait(CYIBitmovinBridgeTransport::Target::Static, FUNCTION_NAME, yi::rapidjson::Document(), yi::rapidjson::Value(yi::rapidjson::kArrayType), [](const yi::rapidjson::Value &result) {
+            if (!result.IsString())
             {
-                YI_LOGE(LOG_TAG, "GetName did not receive a response from the web messaging bridge!");
-            }
-            else if (response.HasError())
-            {
-                YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
+                YI_LOGE(LOG_TAG, "GetName expected a string type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(result.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(result).GetData());
             }
             else
             {
-                const yi::rapidjson::Value *pData = response.GetResult();
-
-                if (!pData->IsString())
-                {
-                    YI_LOGE(LOG_TAG, "GetName expected a string type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-                }
-                else
-                {
-                    type = pData->GetString();
-                }
+                type = result.GetString();
             }
-        }
+        });
     }
 
     return CYIString(type.IsEmpty() ? "Invalid" : type);
@@ -1091,138 +1517,70 @@ CYIString CYIBitmovinVideoPlayerPriv::GetName() const
 
 CYIString CYIBitmovinVideoPlayerPriv::GetNickname() const
 {
-    static const char *FUNCTION_NAME = "getNickname";
-
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
-
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
-
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "GetNickname did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
-        }
-        else
-        {
-            const yi::rapidjson::Value *pData = response.GetResult();
-
-            if (!pData->IsString())
-            {
-                YI_LOGE(LOG_TAG, "GetNickname expected a string type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-            }
-            else
-            {
-                return pData->GetString();
-            }
-        }
-    }
-
-    return CYIString::EmptyString();
+    return m_nickname;
 }
 
 CYIString CYIBitmovinVideoPlayerPriv::GetVersion() const
 {
     static const char *FUNCTION_NAME = "getVersion";
-    static CYIString version;
 
-    if (version.IsEmpty())
+    // the version is also learned from capability probe results, in which case the player is not asked again
+    if (s_playerVersion.IsEmpty())
     {
-        bool messageSent = false;
-        CYIWebMessagingBridge::FutureResponse futureResponse = CallStaticPlayerFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
-
-        if (!messageSent)
-        {
-            YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-        }
-        else
-        {
-            bool valueAssigned = false;
-            CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
-
-            if (!valueAssigned)
-            {
-                YI_LOGE(LOG_TAG, "GetVersion did not receive a response from the web messaging bridge!");
-            }
-            else if (response.HasError())
+        CallPlayerFunctionAndWait(CYIBitmovinBridgeTransport::Target::Static, FUNCTION_NAME, yi::rapidjson::Document(), yi::rapidjson::Value(yi::rapidjson::kArrayType), [](const yi::rapidjson::Value &result) {
+            if (!result.IsString())
             {
-                YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
+                YI_LOGE(LOG_TAG, "GetVersion expected a string type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(result.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(result).GetData());
             }
             else
             {
-                const yi::rapidjson::Value *pData = response.GetResult();
-
-                if (!pData->IsString())
-                {
-                    YI_LOGE(LOG_TAG, "GetVersion expected a string type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-                }
-                else
-                {
-                    version = pData->GetString();
-                }
+                s_playerVersion = result.GetString();
             }
-        }
+        });
     }
 
-    return version.IsEmpty() ? "Unknown" : version;
+    return s_playerVersion.IsEmpty() ? "Unknown" : s_playerVersion;
 }
 
 void CYIBitmovinVideoPlayerPriv::SetNickname(const CYIString &nickname) const
 {
     static const char *FUNCTION_NAME = "setNickname";
 
-    yi::rapidjson::Document command(yi::rapidjson::kObjectType);
+    m_nickname = nickname;
+
+    yi::rapidjson::Document command(m_commandPipeline.CreateCommand());
     yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
 
     yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
     yi::rapidjson::Value nicknameValue(nickname.GetData(), allocator);
     arguments.PushBack(nicknameValue, allocator);
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
+    // failures are logged by the command pipeline, the nickname is only used to identify the player in log output
+    m_commandPipeline.Send(CYIBitmovinCommandPipeline::Target::Instance, FUNCTION_NAME, std::move(command), std::move(arguments));
+}
 
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+CYIAbstractVideoPlayer::Statistics CYIBitmovinVideoPlayerPriv::GetStatistics() const
+{
+    return m_statisticsSnapshot.Read();
+}
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "SetNickname did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
-        }
-    }
+uint64_t CYIBitmovinVideoPlayerPriv::GetStatisticsGeneration() const
+{
+    return m_statisticsSnapshot.GetGeneration();
 }
 
-CYIAbstractVideoPlayer::Statistics CYIBitmovinVideoPlayerPriv::GetStatistics() const
+void CYIBitmovinVideoPlayerPriv::PublishStatistics()
 {
     CYIAbstractVideoPlayer::Statistics stats;
     stats.isLive = m_isLive;
     stats.audioBitrateKbps = m_currentAudioBitrateKbps;
-    stats.defaultAudioBitrateKbps = m_initialVideoBitrateKbps;
+    stats.defaultAudioBitrateKbps = m_initialAudioBitrateKbps;
     stats.videoBitrateKbps = m_currentVideoBitrateKbps;
     stats.defaultVideoBitrateKbps = m_initialVideoBitrateKbps;
     stats.totalBitrateKbps = m_currentTotalBitrateKbps;
     stats.defaultTotalBitrateKbps = m_initialTotalBitrateKbps;
     stats.bufferLengthMs = m_bufferLengthMs;
-    return stats;
+    m_statisticsSnapshot.Publish(stats);
 }
 
 std::unique_ptr<CYIVideoSurface> CYIBitmovinVideoPlayerPriv::CreateSurface()
@@ -1233,196 +1591,547 @@ std::unique_ptr<CYIVideoSurface> CYIBitmovinVideoPlayerPriv::CreateSurface()
 
 bool CYIBitmovinVideoPlayerPriv::SupportsFormat(CYIAbstractVideoPlayer::StreamingFormat format, CYIAbstractVideoPlayer::DRMScheme drmScheme) const
 {
-    static const char *FUNCTION_NAME = "isStreamFormatSupported";
-
-    yi::rapidjson::Document command(yi::rapidjson::kObjectType);
-    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
-
-    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
-    CYIString streamFormatName(StreamFormatToString(format));
-
-    yi::rapidjson::Value streamFormatValue(streamFormatName.GetData(), allocator);
-    arguments.PushBack(streamFormatValue, allocator);
-
-    CYIString drmSchemeName(DRMSchemeToString(drmScheme));
-    if (drmScheme != CYIAbstractVideoPlayer::DRMScheme::None && !drmSchemeName.IsEmpty())
-    {
-        yi::rapidjson::Value drmSchemeValue(drmSchemeName.GetData(), allocator);
-        arguments.PushBack(drmSchemeValue, allocator);
-    }
-
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
-
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
+    if (s_capabilityMatrix.supported.empty() && !s_capabilityLookupFailed)
     {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+        CapabilityMatrix capabilityMatrix;
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "SupportsFormat did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
+        // capabilities cached on disk are served without asking the player and are trusted until they are revalidated by the probe sent
+        // when the player is initialized. The player is only asked right away when nothing usable is cached, and a failed probe is not
+        // repeated for every format since each attempt blocks, formats are reported as unsupported until the asynchronous probe succeeds.
+        if (LoadCapabilityMatrix(capabilityMatrix, s_playerVersion))
         {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
+            s_capabilityMatrix = std::move(capabilityMatrix);
         }
-        else
+        else if (!ProbeCapabilitiesNow())
         {
-            const yi::rapidjson::Value *pData = response.GetResult();
-
-            if (!pData->IsBool())
-            {
-                YI_LOGE(LOG_TAG, "SupportsFormat expected a boolean type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-            }
-            else
-            {
-                return pData->GetBool();
-            }
+            s_capabilityLookupFailed = true;
+            return false;
         }
     }
 
-    return false;
+    std::map<std::pair<CYIAbstractVideoPlayer::StreamingFormat, CYIAbstractVideoPlayer::DRMScheme>, bool>::const_iterator supportedIterator = s_capabilityMatrix.supported.find(std::make_pair(format, drmScheme));
+
+    return supportedIterator != s_capabilityMatrix.supported.end() && supportedIterator->second;
 }
 
-void CYIBitmovinVideoPlayerPriv::Prepare(const CYIUrl &videoURI, CYIAbstractVideoPlayer::StreamingFormat format)
+std::map<CYIString, uint64_t> CYIBitmovinVideoPlayerPriv::GetEventCounts() const
 {
-    static const char *FUNCTION_NAME = "prepare";
-    static const uint32_t PREPARE_TIMEOUT_MS = 3000;
+    return m_eventDispatcher.GetDispatchCounts();
+}
 
-    yi::rapidjson::Document command(yi::rapidjson::kObjectType);
-    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
+CYIBitmovinVideoPlayer::QoESummary CYIBitmovinVideoPlayerPriv::GetQoESummary() const
+{
+    return m_qoeMetrics.GetSummary();
+}
 
-    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
-    yi::rapidjson::Value playerConfigurationValue(yi::rapidjson::kObjectType);
+void CYIBitmovinVideoPlayerPriv::SetBitrateHistoryMemoryBudget(size_t memoryBudgetBytes)
+{
+    m_bitrateHistory.SetMemoryBudget(memoryBudgetBytes);
+}
 
-    CYIString url(videoURI.ToString());
-    yi::rapidjson::Value urlValue(url.GetData(), allocator);
-    playerConfigurationValue.AddMember(yi::rapidjson::StringRef("url"), urlValue, allocator);
+std::vector<CYIBitmovinVideoPlayer::BitrateSample> CYIBitmovinVideoPlayerPriv::GetBitrateHistory(uint64_t startTimeMs, uint64_t endTimeMs) const
+{
+    return m_bitrateHistory.GetSamples(startTimeMs, endTimeMs);
+}
 
-    CYIString streamFormatName(StreamFormatToString(format));
-    yi::rapidjson::Value streamFormatValue(streamFormatName.GetData(), allocator);
-    playerConfigurationValue.AddMember(yi::rapidjson::StringRef("format"), streamFormatValue, allocator);
+std::vector<CYIBitmovinVideoPlayer::BitrateSample> CYIBitmovinVideoPlayerPriv::GetDownsampledBitrateHistory(size_t maximumSampleCount, uint64_t startTimeMs, uint64_t endTimeMs) const
+{
+    return m_bitrateHistory.GetDownsampledSamples(startTimeMs, endTimeMs, maximumSampleCount);
+}
 
-    playerConfigurationValue.AddMember(yi::rapidjson::StringRef("startTimeSeconds"), yi::rapidjson::Value(m_pPub->m_initialStartTimeMs / 1000.0), allocator);
+bool CYIBitmovinVideoPlayerPriv::ExportBitrateHistory(const CYIString &filePath, CYIBitmovinVideoPlayer::BitrateHistoryFormat format) const
+{
+    return m_bitrateHistory.ExportToFile(filePath, format);
+}
 
-    playerConfigurationValue.AddMember(yi::rapidjson::StringRef("maxBitrateKbps"), yi::rapidjson::Value(static_cast<double>(m_pPub->m_maxBitrate) / BITRATE_KBPS_SCALE), allocator);
+void CYIBitmovinVideoPlayerPriv::SetCapabilityCacheFilePath(const CYIString &filePath)
+{
+    s_capabilityCacheFilePath = filePath;
+}
 
-    AddDRMConfigurationToValue(m_pPub->m_pDRMConfiguration.get(), playerConfigurationValue, allocator);
+std::vector<CYIBitmovinVideoPlayer::BridgeLatencyStatistics> CYIBitmovinVideoPlayerPriv::GetBridgeLatencyStatistics()
+{
+    std::vector<CYIBitmovinVideoPlayer::BridgeLatencyStatistics> bridgeLatencyStatistics;
 
-    arguments.PushBack(playerConfigurationValue, allocator);
+    for (const CYIBitmovinLatencyRecorder::Summary &summary : s_latencyRecorder.GetSummaries())
+    {
+        CYIBitmovinVideoPlayer::BridgeLatencyStatistics statistics;
+        statistics.functionName = summary.functionName;
+        statistics.count = summary.count;
+        statistics.errorCount = summary.errorCount;
+        statistics.timeoutCount = summary.timeoutCount;
+        statistics.minUs = summary.minUs;
+        statistics.meanUs = summary.meanUs;
+        statistics.p50Us = summary.p50Us;
+        statistics.p90Us = summary.p90Us;
+        statistics.p99Us = summary.p99Us;
+        statistics.maxUs = summary.maxUs;
+
+        bridgeLatencyStatistics.push_back(statistics);
+    }
+
+    return bridgeLatencyStatistics;
+}
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
+bool CYIBitmovinVideoPlayerPriv::DumpBridgeLatencyStatistics(const CYIString &filePath)
+{
+    return s_latencyRecorder.DumpToFile(filePath);
+}
+
+void CYIBitmovinVideoPlayerPriv::SetBridgeTimeoutPolicy(const CYIBitmovinLatencyRecorder::TimeoutPolicy &timeoutPolicy)
+{
+    s_latencyRecorder.SetTimeoutPolicy(timeoutPolicy);
+}
 
-    if (!messageSent)
+bool CYIBitmovinVideoPlayerPriv::StartBridgeRecording(const CYIString &filePath, uint64_t maximumCaptureSizeBytes)
+{
+    if (s_pBridgeRecorder)
     {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
+        YI_LOGW(LOG_TAG, "A bridge recording is already in progress.");
+        return false;
     }
-    else
+
+    std::unique_ptr<CYIBitmovinBridgeRecorder> pBridgeRecorder(new CYIBitmovinBridgeRecorder(CYIBitmovinBridgeTransport::GetInstance()));
+
+    // only the player's own traffic is needed to replay a capture, log batches sharing the bridge would only grow the capture file
+    pBridgeRecorder->SetRecordedClassName(VIDEO_PLAYER_CLASS_NAME);
+
+    if (!pBridgeRecorder->Open(filePath, maximumCaptureSizeBytes))
     {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(PREPARE_TIMEOUT_MS, &valueAssigned);
+        return false;
+    }
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "Prepare did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
-        }
+    s_pBridgeRecorder = std::move(pBridgeRecorder);
+    CYIBitmovinBridgeTransport::SetInstance(s_pBridgeRecorder.get());
+
+    YI_LOGI(LOG_TAG, "Recording bridge traffic to %s.", filePath.GetData());
+
+    return true;
+}
+
+void CYIBitmovinVideoPlayerPriv::StopBridgeRecording()
+{
+    if (!s_pBridgeRecorder)
+    {
+        return;
     }
+
+    // note: the event handlers registered through the recorder stay registered with the wrapped transport and keep working once the capture file is closed
+    CYIBitmovinBridgeTransport::SetInstance(s_pBridgeRecorder->GetTransport());
+
+    YI_LOGI(LOG_TAG, "Stopped bridge recording after %llu records.", (long long unsigned)s_pBridgeRecorder->GetRecordCount());
+
+    s_pBridgeRecorder.reset();
 }
 
-void CYIBitmovinVideoPlayerPriv::Play()
+CYIBitmovinVideoPlayerPriv::PlayerPrewarm::PlayerPrewarm()
+    : pCommandPipeline(new CYIBitmovinCommandPipeline(VIDEO_PLAYER_CLASS_NAME, VIDEO_PLAYER_INSTANCE_ACCESSOR_NAME))
+    , state(State::Idle)
+    , generation(0)
 {
-    static const char *FUNCTION_NAME = "play";
+    pCommandPipeline->SetLatencyRecorder(&s_latencyRecorder);
+}
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
+CYIFuture<bool> CYIBitmovinVideoPlayerPriv::Prewarm(yi::rapidjson::Document &&playerConfiguration)
+{
+    static const char *FUNCTION_NAME = "prewarm";
 
-    if (!messageSent)
+    // a pre-warm in flight, or a warm player which no player has attached to yet, is shared with later callers
+    if (s_pPlayerPrewarm && s_pPlayerPrewarm->state != PlayerPrewarm::State::Idle)
     {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
+        return s_pPlayerPrewarm->readyFuture;
     }
-    else
+
+    if (!CYIBitmovinBridgeTransport::GetInstance()->IsConnected())
     {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+        YI_LOGE(LOG_TAG, "CYIBitmovinVideoPlayer is not available on this platform or platform configuration.");
+
+        // nothing is kept, so that pre-warming can be retried once the bridge is connected
+        CYIFuture<bool> unavailableFuture;
+        unavailableFuture.Set(false);
+        return unavailableFuture;
+    }
+
+    if (!s_pPlayerPrewarm)
+    {
+        s_pPlayerPrewarm.reset(new PlayerPrewarm());
+    }
+
+    s_pPlayerPrewarm->readyFuture = CYIFuture<bool>();
+    s_pPlayerPrewarm->state = PlayerPrewarm::State::Pending;
+
+    CYIFuture<bool> readyFuture = s_pPlayerPrewarm->readyFuture;
+    uint64_t generation = s_pPlayerPrewarm->generation;
 
-        if (!valueAssigned)
+    CYIBitmovinCommandPipeline &commandPipeline = *s_pPlayerPrewarm->pCommandPipeline;
+
+    yi::rapidjson::Document command(commandPipeline.CreateCommand());
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
+
+    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
+    arguments.PushBack(yi::rapidjson::Value(playerConfiguration, allocator), allocator);
+
+    // note: the response is only delivered while the pipeline exists, so the pre-warm is still alive when the callback runs
+    commandPipeline.Send(CYIBitmovinCommandPipeline::Target::Static, FUNCTION_NAME, std::move(command), std::move(arguments), [readyFuture, generation](const CYIBitmovinCommandPipeline::Result &result) mutable {
+        bool ready = result.success && result.pValue && result.pValue->IsBool() && result.pValue->GetBool();
+
+        if (!ready)
         {
-            YI_LOGE(LOG_TAG, "Play did not receive a response from the web messaging bridge!");
+            YI_LOGW(LOG_TAG, "Failed to pre-warm the Bitmovin video player, it will be constructed once a player is initialized instead.");
         }
-        else if (response.HasError())
+
+        if (s_pPlayerPrewarm->generation == generation)
         {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
+            s_pPlayerPrewarm->state = ready ? PlayerPrewarm::State::Ready : PlayerPrewarm::State::Idle;
         }
-    }
+
+        readyFuture.Set(ready);
+
+        // a pre-warm which failed, or which was consumed while this response was outstanding, is released now that nothing waits on it. This
+        // runs inside the pre-warm's pipeline, so the pipeline is handed to the scheduler to be destroyed on its next tick.
+        if (s_pPlayerPrewarm && s_pPlayerPrewarm->state == PlayerPrewarm::State::Idle && s_pPlayerPrewarm->pCommandPipeline->GetPendingCommandCount() == 0)
+        {
+            CYIBitmovinBridgeScheduler::GetInstance().ReleaseOnNextTick(std::move(s_pPlayerPrewarm->pCommandPipeline));
+            s_pPlayerPrewarm.reset();
+        }
+    });
+
+    // sent right away rather than with the next batch, it must reach the JS player ahead of any player created in the meantime
+    commandPipeline.Flush();
+
+    return readyFuture;
 }
 
-void CYIBitmovinVideoPlayerPriv::Pause()
+void CYIBitmovinVideoPlayerPriv::ConsumePlayerPrewarm()
 {
-    static const char *FUNCTION_NAME = "pause";
+    if (!s_pPlayerPrewarm)
+    {
+        return;
+    }
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
+    // the player instance being created attaches to the warm JavaScript player, the next pre-warm has to construct another one
+    s_pPlayerPrewarm->generation++;
+    s_pPlayerPrewarm->state = PlayerPrewarm::State::Idle;
 
-    if (!messageSent)
+    ReleaseIdlePlayerPrewarm();
+}
+
+void CYIBitmovinVideoPlayerPriv::ReleaseIdlePlayerPrewarm()
+{
+    // an outstanding response still has to resolve the future of the callers waiting on it, the pre-warm is released later in that case
+    if (s_pPlayerPrewarm && s_pPlayerPrewarm->state == PlayerPrewarm::State::Idle && s_pPlayerPrewarm->pCommandPipeline->GetPendingCommandCount() == 0)
     {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
+        s_pPlayerPrewarm.reset();
     }
-    else
+}
+
+void CYIBitmovinVideoPlayerPriv::ReleasePrewarm()
+{
+    // the outstanding response is dropped along with the pipeline, so the callers waiting on it are told that the pre-warm failed
+    if (s_pPlayerPrewarm && s_pPlayerPrewarm->pCommandPipeline->GetPendingCommandCount() > 0)
     {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+        s_pPlayerPrewarm->readyFuture.Set(false);
+    }
+
+    s_pPlayerPrewarm.reset();
+}
+
+void CYIBitmovinVideoPlayerPriv::ProbeCapabilities()
+{
+    static const char *FUNCTION_NAME = "getStreamFormatSupport";
+
+    yi::rapidjson::Document command(m_commandPipeline.CreateCommand());
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
+
+    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
+    arguments.PushBack(CreateCapabilityQueriesValue(allocator), allocator);
+
+    s_pCapabilityProbeOwner = this;
+
+    // failures are logged by the command pipeline, cached capabilities remain in use until a probe succeeds
+    m_commandPipeline.Send(CYIBitmovinCommandPipeline::Target::Instance, FUNCTION_NAME, std::move(command), std::move(arguments), [](const CYIBitmovinCommandPipeline::Result &result) {
+        s_pCapabilityProbeOwner = nullptr;
+
+        CapabilityMatrix capabilityMatrix;
 
-        if (!valueAssigned)
+        if (result.success && result.pValue && ParseCapabilityProbeResult(*result.pValue, capabilityMatrix))
         {
-            YI_LOGE(LOG_TAG, "Pause did not receive a response from the web messaging bridge!");
+            s_capabilityMatrixRevalidated = true;
+
+            UpdateCapabilityMatrix(std::move(capabilityMatrix));
         }
-        else if (response.HasError())
+    });
+}
+
+bool CYIBitmovinVideoPlayerPriv::ProbeCapabilitiesNow() const
+{
+    static const char *FUNCTION_NAME = "getStreamFormatSupport";
+
+    yi::rapidjson::Document command(yi::rapidjson::kObjectType);
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
+
+    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
+    arguments.PushBack(CreateCapabilityQueriesValue(allocator), allocator);
+
+    CapabilityMatrix capabilityMatrix;
+    bool parsed = false;
+
+    CallPlayerFunctionAndWait(CYIBitmovinBridgeTransport::Target::Instance, FUNCTION_NAME, std::move(command), std::move(arguments), [&capabilityMatrix, &parsed](const yi::rapidjson::Value &result) {
+        parsed = ParseCapabilityProbeResult(result, capabilityMatrix);
+    });
+
+    if (!parsed)
+    {
+        return false;
+    }
+
+    s_capabilityMatrixRevalidated = true;
+
+    UpdateCapabilityMatrix(std::move(capabilityMatrix));
+
+    return true;
+}
+
+yi::rapidjson::Value CYIBitmovinVideoPlayerPriv::CreateCapabilityQueriesValue(yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator)
+{
+    yi::rapidjson::Value queriesValue(yi::rapidjson::kArrayType);
+
+    for (CYIAbstractVideoPlayer::StreamingFormat format : STREAMING_FORMATS)
+    {
+        for (CYIAbstractVideoPlayer::DRMScheme drmScheme : DRM_SCHEMES)
         {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
+            yi::rapidjson::Value queryValue(yi::rapidjson::kArrayType);
+
+            CYIString streamFormatName(StreamFormatToString(format));
+            yi::rapidjson::Value streamFormatValue(streamFormatName.GetData(), allocator);
+            queryValue.PushBack(streamFormatValue, allocator);
+
+            if (drmScheme != CYIAbstractVideoPlayer::DRMScheme::None)
+            {
+                CYIString drmSchemeName(DRMSchemeToString(drmScheme));
+                yi::rapidjson::Value drmSchemeValue(drmSchemeName.GetData(), allocator);
+                queryValue.PushBack(drmSchemeValue, allocator);
+            }
+
+            queriesValue.PushBack(queryValue, allocator);
         }
     }
+
+    return queriesValue;
 }
 
-void CYIBitmovinVideoPlayerPriv::Stop()
+bool CYIBitmovinVideoPlayerPriv::ParseCapabilityProbeResult(const yi::rapidjson::Value &resultValue, CapabilityMatrix &capabilityMatrix)
 {
-    static const char *FUNCTION_NAME = "stop";
+    static const size_t QUERY_COUNT = (sizeof(STREAMING_FORMATS) / sizeof(STREAMING_FORMATS[0])) * (sizeof(DRM_SCHEMES) / sizeof(DRM_SCHEMES[0]));
+
+    if (!resultValue.IsObject() || !resultValue.HasMember(CAPABILITY_VERSION_ATTRIBUTE_NAME) || !resultValue[CAPABILITY_VERSION_ATTRIBUTE_NAME].IsString() || !resultValue.HasMember(CAPABILITY_SUPPORTED_ATTRIBUTE_NAME) || !resultValue[CAPABILITY_SUPPORTED_ATTRIBUTE_NAME].IsArray() || resultValue[CAPABILITY_SUPPORTED_ATTRIBUTE_NAME].Size() != QUERY_COUNT)
+    {
+        YI_LOGE(LOG_TAG, "ParseCapabilityProbeResult encountered an invalid capability probe result. JSON string for result: %s", CYIRapidJSONUtility::CreateStringFromValue(resultValue).GetData());
+        return false;
+    }
+
+    const yi::rapidjson::Value &supportedValue = resultValue[CAPABILITY_SUPPORTED_ATTRIBUTE_NAME];
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
+    capabilityMatrix.playerVersion = resultValue[CAPABILITY_VERSION_ATTRIBUTE_NAME].GetString();
+    capabilityMatrix.supported.clear();
 
-    if (!messageSent)
+    yi::rapidjson::SizeType queryIndex = 0;
+
+    for (CYIAbstractVideoPlayer::StreamingFormat format : STREAMING_FORMATS)
     {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
+        for (CYIAbstractVideoPlayer::DRMScheme drmScheme : DRM_SCHEMES)
+        {
+            const yi::rapidjson::Value &queryResultValue = supportedValue[queryIndex++];
+
+            capabilityMatrix.supported[std::make_pair(format, drmScheme)] = queryResultValue.IsBool() && queryResultValue.GetBool();
+        }
     }
-    else
+
+    return true;
+}
+
+void CYIBitmovinVideoPlayerPriv::UpdateCapabilityMatrix(CapabilityMatrix &&capabilityMatrix)
+{
+    bool changed = capabilityMatrix.playerVersion != s_capabilityMatrix.playerVersion || capabilityMatrix.supported != s_capabilityMatrix.supported;
+
+    // probe results come from the running player, so they also tell which version is running
+    s_playerVersion = capabilityMatrix.playerVersion;
+    s_capabilityMatrix = std::move(capabilityMatrix);
+    s_capabilityLookupFailed = false;
+
+    if (changed)
+    {
+        SaveCapabilityMatrix(s_capabilityMatrix);
+    }
+}
+
+bool CYIBitmovinVideoPlayerPriv::LoadCapabilityMatrix(CapabilityMatrix &capabilityMatrix, const CYIString &playerVersion)
+{
+    if (s_capabilityCacheFilePath.IsEmpty())
+    {
+        return false;
+    }
+
+    std::ifstream cacheFile(s_capabilityCacheFilePath.GetData());
+
+    if (!cacheFile.is_open())
+    {
+        return false;
+    }
+
+    std::stringstream cacheStream;
+    cacheStream << cacheFile.rdbuf();
+
+    yi::rapidjson::Document cacheDocument;
+    cacheDocument.Parse(cacheStream.str().c_str());
+
+    if (cacheDocument.HasParseError() || !ParseCapabilityProbeResult(cacheDocument, capabilityMatrix))
     {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+        YI_LOGW(LOG_TAG, "Ignoring invalid capability cache file: %s", s_capabilityCacheFilePath.GetData());
+        return false;
+    }
+
+    // while the running version is unknown the cache is kept, the probe sent when the player is initialized replaces it if it is stale
+    if (!playerVersion.IsEmpty() && capabilityMatrix.playerVersion != playerVersion)
+    {
+        YI_LOGI(LOG_TAG, "Discarding capability cache file written by player version %s, running player version is %s.", capabilityMatrix.playerVersion.GetData(), playerVersion.GetData());
+
+        cacheFile.close();
+        std::remove(s_capabilityCacheFilePath.GetData());
+        return false;
+    }
+
+    return true;
+}
 
-        if (!valueAssigned)
+void CYIBitmovinVideoPlayerPriv::SaveCapabilityMatrix(const CapabilityMatrix &capabilityMatrix)
+{
+    if (s_capabilityCacheFilePath.IsEmpty())
+    {
+        return;
+    }
+
+    yi::rapidjson::Document cacheDocument(yi::rapidjson::kObjectType);
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = cacheDocument.GetAllocator();
+
+    // the cache is stored in the same format as the capability probe result so that it can be parsed the same way
+    yi::rapidjson::Value versionValue(capabilityMatrix.playerVersion.GetData(), allocator);
+    cacheDocument.AddMember(yi::rapidjson::StringRef(CAPABILITY_VERSION_ATTRIBUTE_NAME), versionValue, allocator);
+
+    yi::rapidjson::Value supportedValue(yi::rapidjson::kArrayType);
+
+    for (CYIAbstractVideoPlayer::StreamingFormat format : STREAMING_FORMATS)
+    {
+        for (CYIAbstractVideoPlayer::DRMScheme drmScheme : DRM_SCHEMES)
         {
-            YI_LOGE(LOG_TAG, "Stop did not receive a response from the web messaging bridge!");
+            std::map<std::pair<CYIAbstractVideoPlayer::StreamingFormat, CYIAbstractVideoPlayer::DRMScheme>, bool>::const_iterator supportedIterator = capabilityMatrix.supported.find(std::make_pair(format, drmScheme));
+
+            supportedValue.PushBack(yi::rapidjson::Value(supportedIterator != capabilityMatrix.supported.end() && supportedIterator->second), allocator);
         }
-        else if (response.HasError())
+    }
+
+    cacheDocument.AddMember(yi::rapidjson::StringRef(CAPABILITY_SUPPORTED_ATTRIBUTE_NAME), supportedValue, allocator);
+
+    std::ofstream cacheFile(s_capabilityCacheFilePath.GetData(), std::ios::out | std::ios::trunc);
+
+    if (!cacheFile.is_open())
+    {
+        YI_LOGW(LOG_TAG, "Failed to write capability cache file: %s", s_capabilityCacheFilePath.GetData());
+        return;
+    }
+
+    cacheFile << CYIRapidJSONUtility::CreateStringFromValue(cacheDocument).GetData();
+}
+
+void CYIBitmovinVideoPlayerPriv::Prepare(const CYIUrl &videoURI, CYIAbstractVideoPlayer::StreamingFormat format)
+{
+    static const char *FUNCTION_NAME = "prepare";
+    static const uint32_t PREPARE_TIMEOUT_MS = 3000; // only used until the adaptive timeout for prepare is known
+
+    yi::rapidjson::Document command(m_commandPipeline.CreateCommand());
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
+
+    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
+    yi::rapidjson::Value playerConfigurationValue(yi::rapidjson::kObjectType);
+
+    CYIString url(videoURI.ToString());
+    yi::rapidjson::Value urlValue(url.GetData(), allocator);
+    playerConfigurationValue.AddMember(yi::rapidjson::StringRef("url"), urlValue, allocator);
+
+    CYIString streamFormatName(StreamFormatToString(format));
+    yi::rapidjson::Value streamFormatValue(streamFormatName.GetData(), allocator);
+    playerConfigurationValue.AddMember(yi::rapidjson::StringRef("format"), streamFormatValue, allocator);
+
+    playerConfigurationValue.AddMember(yi::rapidjson::StringRef("startTimeSeconds"), yi::rapidjson::Value(m_pPub->m_initialStartTimeMs / 1000.0), allocator);
+
+    playerConfigurationValue.AddMember(yi::rapidjson::StringRef("maxBitrateKbps"), yi::rapidjson::Value(static_cast<double>(m_pPub->m_maxBitrate) / BITRATE_KBPS_SCALE), allocator);
+
+    AddDRMConfigurationToValue(m_pPub->m_pDRMConfiguration.get(), playerConfigurationValue, allocator);
+
+    arguments.PushBack(playerConfigurationValue, allocator);
+
+    m_qoeMetrics.StartSession();
+    m_bitrateHistory.Clear();
+
+    SendPlayerInstanceCommand(FUNCTION_NAME, std::move(command), std::move(arguments), CYIBitmovinCommandPipeline::CompletionCallback(), PREPARE_TIMEOUT_MS);
+}
+
+void CYIBitmovinVideoPlayerPriv::PreloadSource(const CYIUrl &videoURI, CYIAbstractVideoPlayer::StreamingFormat format, CYIAbstractVideoPlayer::DRMConfiguration *pDRMConfiguration)
+{
+    static const char *FUNCTION_NAME = "preloadSource";
+
+    yi::rapidjson::Document command(m_commandPipeline.CreateCommand());
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
+
+    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
+    yi::rapidjson::Value sourceValue(yi::rapidjson::kObjectType);
+
+    CYIString url(videoURI.ToString());
+    yi::rapidjson::Value urlValue(url.GetData(), allocator);
+    sourceValue.AddMember(yi::rapidjson::StringRef("url"), urlValue, allocator);
+
+    CYIString streamFormatName(StreamFormatToString(format));
+    yi::rapidjson::Value streamFormatValue(streamFormatName.GetData(), allocator);
+    sourceValue.AddMember(yi::rapidjson::StringRef("format"), streamFormatValue, allocator);
+
+    AddDRMConfigurationToValue(pDRMConfiguration, sourceValue, allocator);
+
+    arguments.PushBack(sourceValue, allocator);
+
+    // a failed preload only loses the head start, so it is logged rather than reported as a playback error
+    m_commandPipeline.Send(CYIBitmovinCommandPipeline::Target::Instance, FUNCTION_NAME, std::move(command), std::move(arguments), [url](const CYIBitmovinCommandPipeline::Result &result) {
+        if (!result.success)
         {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
+            YI_LOGW(LOG_TAG, "Failed to preload %s: %s", url.GetData(), result.errorMessage.GetData());
         }
-    }
+    });
+}
+
+void CYIBitmovinVideoPlayerPriv::Play()
+{
+    static const char *FUNCTION_NAME = "play";
+
+    SendPlayerInstanceCommand(FUNCTION_NAME);
+}
+
+void CYIBitmovinVideoPlayerPriv::Pause()
+{
+    static const char *FUNCTION_NAME = "pause";
+
+    SendPlayerInstanceCommand(FUNCTION_NAME);
+}
+
+void CYIBitmovinVideoPlayerPriv::Stop()
+{
+    static const char *FUNCTION_NAME = "stop";
+
+    SendPlayerInstanceCommand(FUNCTION_NAME);
 
     m_durationMs = 0;
     m_currentTimeMs = 0;
     m_buffering = false;
     m_isLive = false;
+    m_playing = false;
     m_currentAudioBitrateKbps = -1.0f;
     m_initialAudioBitrateKbps = -1.0f;
     m_currentVideoBitrateKbps = -1.0f;
@@ -1432,8 +2141,18 @@ void CYIBitmovinVideoPlayerPriv::Stop()
     m_bufferLengthMs = -1.0f;
     m_stateBeforeBuffering = CYIAbstractVideoPlayer::PlaybackState::Paused;
 
+    PublishStatistics();
+    ResetSeekState();
+    m_qoeMetrics.Reset();
+
+    m_playheadClock.SetDurationMs(0);
+    m_playheadClock.Reset(0);
+
     m_audioTracks.clear();
     m_textTracks.clear();
+    m_activeAudioTrack = CYIAbstractVideoPlayer::AudioTrackInfo(0);
+    m_activeTextTrack = CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo(0);
+    m_textTrackEnabled = false;
 }
 
 uint64_t CYIBitmovinVideoPlayerPriv::GetDurationMs() const
@@ -1443,88 +2162,139 @@ uint64_t CYIBitmovinVideoPlayerPriv::GetDurationMs() const
 
 uint64_t CYIBitmovinVideoPlayerPriv::GetCurrentTimeMs() const
 {
-    return m_currentTimeMs;
+    return m_playheadClock.GetPositionMs();
+}
+
+void CYIBitmovinVideoPlayerPriv::UpdatePlayheadClock()
+{
+    m_playheadClock.SetRunning(m_playing && !m_buffering && !m_seekInFlight);
 }
 
 void CYIBitmovinVideoPlayerPriv::Seek(uint64_t seekPositionMS)
+{
+    if (m_seekInFlight)
+    {
+        // only the most recent target is kept while a seek is in flight, intermediate targets are dropped
+        if (m_seekQueued)
+        {
+            m_coalescedSeekCount++;
+        }
+
+        m_seekQueued = true;
+        m_queuedSeekPositionMs = seekPositionMS;
+        return;
+    }
+
+    StartSeek(seekPositionMS);
+}
+
+void CYIBitmovinVideoPlayerPriv::StartSeek(uint64_t seekPositionMs)
 {
     static const char *FUNCTION_NAME = "seek";
 
-    yi::rapidjson::Document command(yi::rapidjson::kObjectType);
+    m_seekInFlight = true;
+
+    m_currentSeekTiming = CYIBitmovinVideoPlayer::SeekTiming();
+    m_currentSeekTiming.targetPositionMs = seekPositionMs;
+    m_currentSeekTiming.coalescedSeekCount = m_coalescedSeekCount;
+    m_currentSeekTiming.startTime = std::chrono::steady_clock::now();
+    m_coalescedSeekCount = 0;
+
+    m_playheadClock.Reset(seekPositionMs);
+    UpdatePlayheadClock();
+    m_qoeMetrics.OnSeekStarted(m_currentSeekTiming.startTime);
+
+    m_seekTimeoutTimer.Start(SEEK_TIMEOUT_MS);
+
+    m_pPub->SeekStarted.Emit(m_currentSeekTiming);
+
+    yi::rapidjson::Document command(m_commandPipeline.CreateCommand());
     yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
 
     yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
-    arguments.PushBack(yi::rapidjson::Value(seekPositionMS / 1000.0), allocator);
+    arguments.PushBack(yi::rapidjson::Value(seekPositionMs / 1000.0), allocator);
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
+    SendPlayerInstanceCommand(FUNCTION_NAME, std::move(command), std::move(arguments), [this, seekPositionMs](const CYIBitmovinCommandPipeline::Result &result) {
+        // the player will not report a completed seek if the seek failed or was not started
+        bool seeking = result.success && (!result.pValue || !result.pValue->IsBool() || result.pValue->GetBool());
 
-    if (!messageSent)
+        if (!seeking && m_seekInFlight && m_currentSeekTiming.targetPositionMs == seekPositionMs)
+        {
+            CompleteSeek();
+        }
+    });
+}
+
+void CYIBitmovinVideoPlayerPriv::CompleteSeek()
+{
+    m_seekTimeoutTimer.Stop();
+
+    m_seekInFlight = false;
+    m_currentSeekTiming.completeTime = std::chrono::steady_clock::now();
+
+    UpdatePlayheadClock();
+    m_qoeMetrics.OnSeekCompleted(m_currentSeekTiming.completeTime);
+
+    m_pPub->SeekCompleted.Emit(m_currentSeekTiming);
+
+    if (m_seekQueued)
+    {
+        m_seekQueued = false;
+        StartSeek(m_queuedSeekPositionMs);
+    }
+}
+
+void CYIBitmovinVideoPlayerPriv::ResetSeekState()
+{
+    m_seekTimeoutTimer.Stop();
+
+    m_seekInFlight = false;
+    m_seekQueued = false;
+    m_queuedSeekPositionMs = 0;
+    m_coalescedSeekCount = 0;
+
+    UpdatePlayheadClock();
+}
+
+void CYIBitmovinVideoPlayerPriv::OnSeekTimeoutTimerTimedOut()
+{
+    if (!m_seekInFlight)
     {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
+        return;
     }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "Seek did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
-        }
-    }
+    YI_LOGW(LOG_TAG, "Seek to %llums was not reported as completed within %llums.", (long long unsigned)m_currentSeekTiming.targetPositionMs, (long long unsigned)SEEK_TIMEOUT_MS);
+
+    CompleteSeek();
 }
 
-bool CYIBitmovinVideoPlayerPriv::SelectAudioTrack(uint32_t id)
+bool CYIBitmovinVideoPlayerPriv::SelectAudioTrack(uint32_t id, CYIFuture<bool> selectedFuture)
 {
     static const char *FUNCTION_NAME = "selectAudioTrack";
 
-    yi::rapidjson::Document command(yi::rapidjson::kObjectType);
+    yi::rapidjson::Document command(m_commandPipeline.CreateCommand());
     yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
 
     yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
     arguments.PushBack(yi::rapidjson::Value(id), allocator);
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
-
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+    return SendPlayerInstanceCommand(FUNCTION_NAME, std::move(command), std::move(arguments), [selectedFuture](const CYIBitmovinCommandPipeline::Result &result) mutable {
+        bool selected = false;
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "SelectAudioTrack did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
-        }
-        else
+        if (result.success)
         {
-            const yi::rapidjson::Value *pData = response.GetResult();
-
-            if (!pData->IsBool())
+            if (!result.pValue || !result.pValue->IsBool())
             {
-                YI_LOGE(LOG_TAG, "SelectAudioTrack expected a boolean type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
+                YI_LOGE(LOG_TAG, "SelectAudioTrack expected a boolean type for result, received %s.", result.pValue ? CYIRapidJSONUtility::TypeToString(result.pValue->GetType()).GetData() : "nothing");
             }
             else
             {
-                return pData->GetBool();
+                selected = result.pValue->GetBool();
             }
         }
-    }
 
-    return false;
+        selectedFuture.Set(selected);
+    });
 }
 
 std::vector<CYIAbstractVideoPlayer::AudioTrackInfo> CYIBitmovinVideoPlayerPriv::GetAudioTracks() const
@@ -1534,91 +2304,12 @@ std::vector<CYIAbstractVideoPlayer::AudioTrackInfo> CYIBitmovinVideoPlayerPriv::
 
 CYIAbstractVideoPlayer::AudioTrackInfo CYIBitmovinVideoPlayerPriv::GetActiveAudioTrack() const
 {
-    static const char *FUNCTION_NAME = "getActiveAudioTrack";
-
-    CYIAbstractVideoPlayer::AudioTrackInfo audioTrackInfo(0);
-
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
-
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
-
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "GetActiveAudioTrack did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
-        }
-        else
-        {
-            const yi::rapidjson::Value *pData = response.GetResult();
-
-            if (!pData->IsObject())
-            {
-                YI_LOGE(LOG_TAG, "GetActiveAudioTrack expected an object type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-            }
-            else
-            {
-                if (!ConvertValueToTrackInfo(*pData, audioTrackInfo))
-                {
-                    YI_LOGW(LOG_TAG, "GetActiveAudioTrack data is invalid. JSON string for track data: %s", CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-                }
-            }
-        }
-    }
-
-    return audioTrackInfo;
+    return m_activeAudioTrack;
 }
 
 bool CYIBitmovinVideoPlayerPriv::IsMuted() const
 {
-    static const char *FUNCTION_NAME = "isMuted";
-
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
-
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
-
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "IsMuted did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
-        }
-        else
-        {
-            const yi::rapidjson::Value *pData = response.GetResult();
-
-            if (!pData->IsBool())
-            {
-                YI_LOGE(LOG_TAG, "IsMuted expected a boolean type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-            }
-            else
-            {
-                return pData->GetBool();
-            }
-        }
-    }
-
-    return false;
+    return m_muted;
 }
 
 void CYIBitmovinVideoPlayerPriv::Mute(bool mute)
@@ -1626,172 +2317,59 @@ void CYIBitmovinVideoPlayerPriv::Mute(bool mute)
     static const char *MUTE_FUNCTION_NAME = "mute";
     static const char *UNMUTE_FUNCTION_NAME = "unmute";
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), mute ? MUTE_FUNCTION_NAME: UNMUTE_FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
-
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", mute ? MUTE_FUNCTION_NAME: UNMUTE_FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+    // the mirrored mute status is updated immediately and confirmed by the muteStatusChanged event
+    m_muted = mute;
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "DisableTextTrack did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
-        }
-    }
+    SendPlayerInstanceCommand(mute ? MUTE_FUNCTION_NAME : UNMUTE_FUNCTION_NAME);
 }
 
 bool CYIBitmovinVideoPlayerPriv::IsTextTrackEnabled() const
 {
-    static const char *FUNCTION_NAME = "isTextTrackEnabled";
-
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
-
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
-
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "IsTextTrackEnabled did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
-        }
-        else
-        {
-            const yi::rapidjson::Value *pData = response.GetResult();
-
-            if (!pData->IsBool())
-            {
-                YI_LOGE(LOG_TAG, "IsTextTrackEnabled expected a boolean type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-            }
-            else
-            {
-                return pData->GetBool();
-            }
-        }
-    }
-
-    return false;
+    return m_textTrackEnabled;
 }
 
 void CYIBitmovinVideoPlayerPriv::EnableTextTrack()
 {
     static const char *FUNCTION_NAME = "enableTextTrack";
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
-
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
-
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "EnableTextTrack did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
-        }
-    }
+    SendPlayerInstanceCommand(FUNCTION_NAME);
 }
 
 void CYIBitmovinVideoPlayerPriv::DisableTextTrack()
 {
     static const char *FUNCTION_NAME = "disableTextTrack";
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
-
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
-
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "DisableTextTrack did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
-        }
-    }
+    SendPlayerInstanceCommand(FUNCTION_NAME);
 }
 
-bool CYIBitmovinVideoPlayerPriv::SelectTextTrack(uint32_t id, bool enableTextTrack)
+bool CYIBitmovinVideoPlayerPriv::SelectTextTrack(uint32_t id, bool enableTextTrack, CYIFuture<bool> selectedFuture)
 {
     static const char *FUNCTION_NAME = "selectTextTrack";
 
-    yi::rapidjson::Document command(yi::rapidjson::kObjectType);
+    yi::rapidjson::Document command(m_commandPipeline.CreateCommand());
     yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
 
     yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
     arguments.PushBack(yi::rapidjson::Value(id), allocator);
     arguments.PushBack(yi::rapidjson::Value().SetBool(enableTextTrack), allocator);
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
-
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+    return SendPlayerInstanceCommand(FUNCTION_NAME, std::move(command), std::move(arguments), [selectedFuture](const CYIBitmovinCommandPipeline::Result &result) mutable {
+        bool selected = false;
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "SelectTextTrack did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
+        if (result.success)
         {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
-        }
-        else
-        {
-            const yi::rapidjson::Value *pData = response.GetResult();
-
-            if (!pData->IsBool())
+            if (!result.pValue || !result.pValue->IsBool())
             {
-                YI_LOGE(LOG_TAG, "SelectTextTrack expected a boolean type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
+                YI_LOGE(LOG_TAG, "SelectTextTrack expected a boolean type for result, received %s.", result.pValue ? CYIRapidJSONUtility::TypeToString(result.pValue->GetType()).GetData() : "nothing");
             }
             else
             {
-                return pData->GetBool();
+                selected = result.pValue->GetBool();
             }
         }
-    }
 
-    return false;
+        selectedFuture.Set(selected);
+    });
 }
 
 std::vector<CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo> CYIBitmovinVideoPlayerPriv::GetTextTracks() const
@@ -1801,56 +2379,14 @@ std::vector<CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo> CYIBitmovinVideoPla
 
 CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo CYIBitmovinVideoPlayerPriv::GetActiveTextTrack() const
 {
-    static const char *FUNCTION_NAME = "getActiveTextTrack";
-
-    CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo textTrackInfo(0);
-
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
-
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
-
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "GetActiveTextTrack did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
-        }
-        else
-        {
-            const yi::rapidjson::Value *pData = response.GetResult();
-
-            if (!pData->IsObject())
-            {
-                YI_LOGE(LOG_TAG, "GetActiveTextTrack expected an object type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-            }
-            else
-            {
-                if (!ConvertValueToTrackInfo(*pData, textTrackInfo))
-                {
-                    YI_LOGW(LOG_TAG, "GetActiveTextTrack data is invalid. JSON string for track data: %s", CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-                }
-            }
-        }
-    }
-
-    return textTrackInfo;
+    return m_activeTextTrack;
 }
 
 void CYIBitmovinVideoPlayerPriv::AddExternalTextTrack(const CYIString &url, const CYIString &language, const CYIString &label, const CYIString &type, const CYIString &format, bool enable)
 {
     static const char *FUNCTION_NAME = "addExternalTextTrack";
 
-    yi::rapidjson::Document command(yi::rapidjson::kObjectType);
+    yi::rapidjson::Document command(m_commandPipeline.CreateCommand());
     yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
 
     yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
@@ -1871,27 +2407,7 @@ void CYIBitmovinVideoPlayerPriv::AddExternalTextTrack(const CYIString &url, cons
 
     arguments.PushBack(textTrackDataValue, allocator);
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
-
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
-
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "AddExternalTextTrack did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetStacktrace().GetData());
-        }
-    }
+    SendPlayerInstanceCommand(FUNCTION_NAME, std::move(command), std::move(arguments));
 }
 
 CYIAbstractVideoPlayer::TimedMetadataInterface *CYIBitmovinVideoPlayerPriv::GetTimedMetadataInterface() const
@@ -1901,28 +2417,14 @@ CYIAbstractVideoPlayer::TimedMetadataInterface *CYIBitmovinVideoPlayerPriv::GetT
 
 CYIBitmovinVideoPlayer *CYIBitmovinVideoPlayer::Create(const std::map<CYIString, CYIString> &playerConfiguration)
 {
-    yi::rapidjson::Document playerConfigurationDocument(yi::rapidjson::kObjectType);
-    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = playerConfigurationDocument.GetAllocator();
-
-    for(std::map<CYIString, CYIString>::const_iterator playerConfigIterator = playerConfiguration.begin(); playerConfigIterator != playerConfiguration.end(); playerConfigIterator++)
-    {
-        if(playerConfigIterator->first.IsEmpty()) {
-            continue;
-        }
-
-        yi::rapidjson::Value configKeyValue(playerConfigIterator->first.GetData(), allocator);
-        yi::rapidjson::Value configValueValue(playerConfigIterator->second.GetData(), allocator);
-        playerConfigurationDocument.AddMember(configKeyValue, configValueValue, allocator);
-    }
-
-    return CYIBitmovinVideoPlayer::Create(std::move(playerConfigurationDocument));
+    return CYIBitmovinVideoPlayer::Create(CreatePlayerConfigurationDocument(playerConfiguration));
 }
 
 CYIBitmovinVideoPlayer *CYIBitmovinVideoPlayer::Create(yi::rapidjson::Document &&playerConfiguration)
 {
     CYIBitmovinVideoPlayer *pThis = new CYIBitmovinVideoPlayer();
     pThis->m_pPriv = new CYIBitmovinVideoPlayerPriv(pThis, std::move(playerConfiguration)); 
-    if(!CYIWebBridgeLocator::GetWebMessagingBridge())
+    if(!CYIBitmovinBridgeTransport::GetInstance()->IsConnected())
     {
         YI_LOGE(LOG_TAG, "CYIBitmovinVideoPlayer is not available on this platform or platform configuration.");
 
@@ -1965,6 +2467,11 @@ CYIAbstractVideoPlayer::Statistics CYIBitmovinVideoPlayer::GetStatistics_() cons
     return m_pPriv->GetStatistics();
 }
 
+uint64_t CYIBitmovinVideoPlayer::GetStatisticsGeneration() const
+{
+    return m_pPriv->GetStatisticsGeneration();
+}
+
 void CYIBitmovinVideoPlayer::SetNickname(const CYIString &nickname) const
 {
     m_pPriv->SetNickname(nickname);
@@ -2037,6 +2544,113 @@ bool CYIBitmovinVideoPlayer::SelectAudioTrack_(uint32_t id)
     return m_pPriv->SelectAudioTrack(id);
 }
 
+void CYIBitmovinVideoPlayer::SetCapabilityCacheFilePath(const CYIString &filePath)
+{
+    CYIBitmovinVideoPlayerPriv::SetCapabilityCacheFilePath(filePath);
+}
+
+std::vector<CYIBitmovinVideoPlayer::BridgeLatencyStatistics> CYIBitmovinVideoPlayer::GetBridgeLatencyStatistics()
+{
+    return CYIBitmovinVideoPlayerPriv::GetBridgeLatencyStatistics();
+}
+
+bool CYIBitmovinVideoPlayer::DumpBridgeLatencyStatistics(const CYIString &filePath)
+{
+    return CYIBitmovinVideoPlayerPriv::DumpBridgeLatencyStatistics(filePath);
+}
+
+void CYIBitmovinVideoPlayer::SetBridgeTimeoutPolicy(float p99Multiplier, std::chrono::milliseconds minimumTimeout, std::chrono::milliseconds maximumTimeout)
+{
+    CYIBitmovinLatencyRecorder::TimeoutPolicy timeoutPolicy;
+    timeoutPolicy.p99Multiplier = p99Multiplier;
+    timeoutPolicy.minimumTimeoutMs = static_cast<uint64_t>(std::max<std::chrono::milliseconds::rep>(minimumTimeout.count(), 0));
+    timeoutPolicy.maximumTimeoutMs = static_cast<uint64_t>(std::max<std::chrono::milliseconds::rep>(maximumTimeout.count(), 0));
+
+    CYIBitmovinVideoPlayerPriv::SetBridgeTimeoutPolicy(timeoutPolicy);
+}
+
+CYIFuture<bool> CYIBitmovinVideoPlayer::Prewarm(const std::map<CYIString, CYIString> &playerConfiguration)
+{
+    return CYIBitmovinVideoPlayerPriv::Prewarm(CreatePlayerConfigurationDocument(playerConfiguration));
+}
+
+CYIFuture<bool> CYIBitmovinVideoPlayer::Prewarm(yi::rapidjson::Document &&playerConfiguration)
+{
+    return CYIBitmovinVideoPlayerPriv::Prewarm(std::move(playerConfiguration));
+}
+
+void CYIBitmovinVideoPlayer::ReleasePrewarm()
+{
+    CYIBitmovinVideoPlayerPriv::ReleasePrewarm();
+}
+
+bool CYIBitmovinVideoPlayer::StartBridgeRecording(const CYIString &filePath, uint64_t maximumCaptureSizeBytes)
+{
+    return CYIBitmovinVideoPlayerPriv::StartBridgeRecording(filePath, maximumCaptureSizeBytes);
+}
+
+void CYIBitmovinVideoPlayer::StopBridgeRecording()
+{
+    CYIBitmovinVideoPlayerPriv::StopBridgeRecording();
+}
+
+std::map<CYIString, uint64_t> CYIBitmovinVideoPlayer::GetEventCounts() const
+{
+    return m_pPriv->GetEventCounts();
+}
+
+CYIBitmovinVideoPlayer::QoESummary CYIBitmovinVideoPlayer::GetQoESummary() const
+{
+    return m_pPriv->GetQoESummary();
+}
+
+void CYIBitmovinVideoPlayer::SetBitrateHistoryMemoryBudget(size_t memoryBudgetBytes)
+{
+    m_pPriv->SetBitrateHistoryMemoryBudget(memoryBudgetBytes);
+}
+
+std::vector<CYIBitmovinVideoPlayer::BitrateSample> CYIBitmovinVideoPlayer::GetBitrateHistory(uint64_t startTimeMs, uint64_t endTimeMs) const
+{
+    return m_pPriv->GetBitrateHistory(startTimeMs, endTimeMs);
+}
+
+std::vector<CYIBitmovinVideoPlayer::BitrateSample> CYIBitmovinVideoPlayer::GetDownsampledBitrateHistory(size_t maximumSampleCount, uint64_t startTimeMs, uint64_t endTimeMs) const
+{
+    return m_pPriv->GetDownsampledBitrateHistory(maximumSampleCount, startTimeMs, endTimeMs);
+}
+
+bool CYIBitmovinVideoPlayer::ExportBitrateHistory(const CYIString &filePath, BitrateHistoryFormat format) const
+{
+    return m_pPriv->ExportBitrateHistory(filePath, format);
+}
+
+void CYIBitmovinVideoPlayer::SetVideoRectangleKeyframeInterval(std::chrono::milliseconds keyframeInterval)
+{
+    m_pPriv->SetVideoRectangleKeyframeInterval(keyframeInterval);
+}
+
+void CYIBitmovinVideoPlayer::SetVideoTimeUpdateInterval(std::chrono::milliseconds interval)
+{
+    m_pPriv->SetVideoTimeUpdateInterval(interval);
+}
+
+std::chrono::milliseconds CYIBitmovinVideoPlayer::GetVideoTimeUpdateInterval() const
+{
+    return m_pPriv->GetVideoTimeUpdateInterval();
+}
+
+void CYIBitmovinVideoPlayer::PreloadSource(const CYIUrl &videoURI, StreamingFormat format, CYIAbstractVideoPlayer::DRMConfiguration *pDRMConfiguration)
+{
+    m_pPriv->PreloadSource(videoURI, format, pDRMConfiguration);
+}
+
+CYIFuture<bool> CYIBitmovinVideoPlayer::SelectAudioTrackAsync(uint32_t id)
+{
+    CYIFuture<bool> selectedFuture;
+    m_pPriv->SelectAudioTrack(id, selectedFuture);
+    return selectedFuture;
+}
+
 std::vector<CYIAbstractVideoPlayer::AudioTrackInfo> CYIBitmovinVideoPlayer::GetAudioTracks_() const
 {
     return m_pPriv->GetAudioTracks();
@@ -2067,6 +2681,13 @@ bool CYIBitmovinVideoPlayer::SelectClosedCaptionsTrack_(uint32_t textID)
     return m_pPriv->SelectTextTrack(textID);
 }
 
+CYIFuture<bool> CYIBitmovinVideoPlayer::SelectClosedCaptionsTrackAsync(uint32_t textID)
+{
+    CYIFuture<bool> selectedFuture;
+    m_pPriv->SelectTextTrack(textID, true, selectedFuture);
+    return selectedFuture;
+}
+
 std::vector<CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo> CYIBitmovinVideoPlayer::GetClosedCaptionsTracks_() const
 {
     return m_pPriv->GetTextTracks();
@@ -10,8 +10,12 @@
 
 #include <player/YiAbstractVideoPlayer.h>
 
+#include <thread/YiFuture.h>
 #include <utility/YiRapidJSONUtility.h>
 
+#include <chrono>
+#include <limits>
+
 class CYIBitmovinVideoPlayerPriv;
 
 /*!
@@ -25,6 +29,73 @@ class CYIBitmovinVideoPlayer : public CYIAbstractVideoPlayer
     friend class CYIBitmovinVideoPlayerPriv;
 
 public:
+    /*!
+        \details Timing information for a seek which was sent to the underlying JavaScript player.
+    */
+    struct SeekTiming
+    {
+        uint64_t targetPositionMs = 0;
+        uint32_t coalescedSeekCount = 0; //!< The number of queued seek requests which were replaced by this one before it was sent.
+        std::chrono::steady_clock::time_point startTime;
+        std::chrono::steady_clock::time_point completeTime;
+    };
+
+    /*!
+        \details Quality of experience metrics for the current playback session. A session starts when a video is prepared and ends when
+        the player is stopped. Time before startup completes and time spent seeking counts as neither playing nor stalled time.
+    */
+    struct QoESummary
+    {
+        bool startupComplete = false;
+        uint64_t startupTimeMs = 0; //!< The time from prepare to the first playback progress.
+        uint64_t playingTimeMs = 0;
+        uint64_t stalledTimeMs = 0; //!< Time spent buffering while playback was requested.
+        uint64_t rebufferCount = 0;
+        float rebufferRatio = 0.0f; //!< The stalled time as a fraction of the playing and stalled time.
+        float averageVideoBitrateKbps = -1.0f; //!< Weighted by playing time, -1 until playing time with a known bitrate has been recorded.
+        uint64_t bitrateSwitchCount = 0;
+        uint64_t seekCount = 0;
+        uint64_t lastSeekLatencyMs = 0;
+        uint64_t averageSeekLatencyMs = 0;
+        uint64_t maximumSeekLatencyMs = 0;
+    };
+
+    /*!
+        \details A sample of the bitrates and buffer length reported by the underlying JavaScript player. Values which are not known
+        are reported as -1.
+    */
+    struct BitrateSample
+    {
+        uint64_t timeMs = 0; //!< The time of the sample, in milliseconds since the video was prepared.
+        float videoBitrateKbps = -1.0f;
+        float audioBitrateKbps = -1.0f;
+        float totalBitrateKbps = -1.0f;
+        float bufferLengthMs = -1.0f;
+    };
+
+    enum class BitrateHistoryFormat
+    {
+        CSV,
+        Binary //!< A 'YBH1' magic followed by a uint64 sample count and then the time (uint64), video, audio and total bitrate and buffer length (float) columns, in device byte order.
+    };
+
+    /*!
+        \details Round trip latency of calls to a function of the underlying JavaScript player, measured across all player instances.
+    */
+    struct BridgeLatencyStatistics
+    {
+        CYIString functionName;
+        uint64_t count = 0; //!< The number of responses received, including error responses.
+        uint64_t errorCount = 0;
+        uint64_t timeoutCount = 0;
+        uint64_t minUs = 0;
+        uint64_t meanUs = 0;
+        uint64_t p50Us = 0;
+        uint64_t p90Us = 0;
+        uint64_t p99Us = 0;
+        uint64_t maxUs = 0;
+    };
+
     /*!
         \details Constructs an instance of the CYIBitmovinVideoPlayer.
 
@@ -41,6 +112,77 @@ public:
 
     virtual ~CYIBitmovinVideoPlayer();
 
+    /*!
+        \details Sets the \a filePath used to persist the stream format and DRM scheme capabilities reported by the underlying
+        JavaScript player. When set, cached capabilities are used immediately on startup and revalidated in the background
+        once a player instance is initialized. The cache is discarded if the JavaScript player version changes.
+
+        \note Capabilities are only cached in memory if no file path is set.
+    */
+    static void SetCapabilityCacheFilePath(const CYIString &filePath);
+
+    /*!
+        \details Returns the round trip latency of each JavaScript player function called so far, along with the number
+        of calls which failed or timed out.
+
+        \note Percentiles are approximate, with a relative error of roughly 6%.
+    */
+    static std::vector<BridgeLatencyStatistics> GetBridgeLatencyStatistics();
+
+    /*!
+        \details Writes the current bridge latency statistics to \a filePath in CSV format, returning false if the file could not be written.
+    */
+    static bool DumpBridgeLatencyStatistics(const CYIString &filePath);
+
+    /*!
+        \details Configures the timeout applied to calls to the underlying JavaScript player. Once enough responses have been
+        observed for a function, its timeout becomes \a p99Multiplier times its 99th percentile latency, clamped between
+        \a minimumTimeout and \a maximumTimeout. Responses which arrive after a call has timed out are dropped.
+
+        \note By default, the multiplier is 3 and timeouts are clamped between 250ms and 15s.
+    */
+    static void SetBridgeTimeoutPolicy(float p99Multiplier, std::chrono::milliseconds minimumTimeout, std::chrono::milliseconds maximumTimeout);
+
+    /*!
+        \details Starts writing every call, response and event exchanged with the underlying JavaScript player to the capture file
+        at \a filePath, returning false if a recording is already in progress or the file could not be opened. Captures can be
+        replayed without a JavaScript player through CYIBitmovinBridgeReplayer. Recording stops on its own once the capture file
+        would grow beyond \a maximumCaptureSizeBytes.
+
+        \note Events are only captured for players initialized after the recording was started. Other traffic sharing the bridge,
+        such as remote log messages, is not captured.
+    */
+    static bool StartBridgeRecording(const CYIString &filePath, uint64_t maximumCaptureSizeBytes = 32 * 1024 * 1024);
+
+    /*!
+        \details Stops the recording started by StartBridgeRecording and closes its capture file.
+    */
+    static void StopBridgeRecording();
+
+    /*!
+        \details Starts constructing the underlying JavaScript player in the background so that the cost of spinning it up is paid
+        before playback is first requested, ideally as early as possible during application startup. The \a playerConfiguration
+        should match the one later passed to Create, and the next player to be created and initialized attaches to the pre-warmed
+        JavaScript player instead of constructing a new one. The returned future is resolved with true once the JavaScript player
+        is ready, or with false if it could not be constructed, in which case it is constructed on initialization as usual.
+
+        \note While a pre-warm is in progress, or its JavaScript player has not been attached to yet, later calls return the same
+        future. Once a player attaches to the pre-warmed JavaScript player, or pre-warming fails, the next call pre-warms again.
+
+        \note A player created with a different API key or application ID cannot attach to the pre-warmed JavaScript player,
+        which is then discarded.
+    */
+    static CYIFuture<bool> Prewarm(const std::map<CYIString, CYIString> &playerConfiguration = std::map<CYIString, CYIString>());
+    static CYIFuture<bool> Prewarm(yi::rapidjson::Document &&playerConfiguration);
+
+    /*!
+        \details Releases the resources held for pre-warming. Should be called before the application shuts down if Prewarm was
+        called, the pre-warmed JavaScript player is left in place for the next player to attach to.
+
+        \note The future of a pre-warm which is still in progress is not resolved.
+    */
+    static void ReleasePrewarm();
+
     /*!
         \details Returns the nickname assigned to the current player instance, if any.
     */
@@ -63,6 +205,107 @@ public:
     */
     virtual void AddExternalTextTrack(const CYIString &url, const CYIString &language, const CYIString &label, const CYIString &type, const CYIString &format, bool enable = false);
 
+    /*!
+        \details Limits video surface rectangle updates sent to the underlying JavaScript player to one every \a keyframeInterval,
+        with the JavaScript player interpolating between them at display rate. By default the interval is zero, in which case
+        the latest rectangle is sent once per update tick and applied immediately.
+    */
+    void SetVideoRectangleKeyframeInterval(std::chrono::milliseconds keyframeInterval);
+
+    /*!
+        \details Sets how often the underlying JavaScript player reports the playback position. Updates are throttled at the source,
+        so a longer interval while the player UI is hidden reduces bridge traffic and CPU usage. An interval of zero disables periodic
+        updates entirely, for example during audio-only playback, in which case the position is only reported on seeks and pauses.
+        By default the interval is 250ms.
+
+        \note GetCurrentTimeMs extrapolates the position between updates, so a longer interval does not make it advance in steps.
+
+        \note The position cannot be reported more often than the Bitmovin player raises time changed events, roughly four times per second.
+    */
+    void SetVideoTimeUpdateInterval(std::chrono::milliseconds interval);
+    std::chrono::milliseconds GetVideoTimeUpdateInterval() const;
+
+    /*!
+        \details Gets a head start on a source which is expected to be played next, such as the next item of an autoplay queue,
+        without disturbing current playback. The JavaScript player fetches the manifest of adaptive sources or the start of
+        progressive ones, initializes the content decryption module required by \a pDRMConfiguration, and constructs its player
+        ahead of time if it was torn down by Stop. A later Prepare of the same \a videoURI picks the fetched data up from the HTTP cache.
+
+        \note The DRM configuration is not retained and must still be set before calling Prepare. Only the three most recently
+        preloaded sources are kept.
+    */
+    void PreloadSource(const CYIUrl &videoURI, StreamingFormat format, CYIAbstractVideoPlayer::DRMConfiguration *pDRMConfiguration = nullptr);
+
+    /*!
+        \details Requests that the audio track with the specified \a id be selected without waiting for the underlying
+        JavaScript player to respond. The returned future is resolved with the selection result once the response is received.
+
+        \note Failures to communicate with the JavaScript player are also reported through the ErrorOccurred signal.
+    */
+    CYIFuture<bool> SelectAudioTrackAsync(uint32_t id);
+
+    /*!
+        \details Requests that the closed captions track with the specified \a id be selected without waiting for the
+        underlying JavaScript player to respond. The returned future is resolved with the selection result once the response is received.
+
+        \note Failures to communicate with the JavaScript player are also reported through the ErrorOccurred signal.
+    */
+    CYIFuture<bool> SelectClosedCaptionsTrackAsync(uint32_t id);
+
+    /*!
+        \details Returns the generation of the statistics returned by GetStatistics. The statistics are published as a single
+        consistent block, and the generation only changes when a new block with different values is published, so callers
+        polling the statistics every frame can skip their work while the generation is unchanged.
+    */
+    uint64_t GetStatisticsGeneration() const;
+
+    /*!
+        \details Returns a snapshot of the quality of experience metrics for the current playback session. The metrics are updated as
+        player events arrive, at a constant cost per event.
+    */
+    QoESummary GetQoESummary() const;
+
+    /*!
+        \details Sets the memory budget of the bitrate history, which records a sample each time the bitrates or the current time
+        are reported by the underlying JavaScript player. Once the history is full, each new sample replaces the oldest one. A budget
+        smaller than one sample disables the history.
+
+        \note By default, the budget is 128KB, roughly 90 minutes of samples at the default video time update interval.
+    */
+    void SetBitrateHistoryMemoryBudget(size_t memoryBudgetBytes);
+
+    /*!
+        \details Returns the recorded bitrate history samples between \a startTimeMs and \a endTimeMs inclusively, oldest first.
+    */
+    std::vector<BitrateSample> GetBitrateHistory(uint64_t startTimeMs = 0, uint64_t endTimeMs = std::numeric_limits<uint64_t>::max()) const;
+
+    /*!
+        \details Returns at most \a maximumSampleCount samples covering the recorded bitrate history between \a startTimeMs and \a endTimeMs,
+        each one averaging the samples of an equal slice of the range.
+    */
+    std::vector<BitrateSample> GetDownsampledBitrateHistory(size_t maximumSampleCount, uint64_t startTimeMs = 0, uint64_t endTimeMs = std::numeric_limits<uint64_t>::max()) const;
+
+    /*!
+        \details Writes the recorded bitrate history to \a filePath in the specified \a format, returning false if the file could not be written.
+    */
+    bool ExportBitrateHistory(const CYIString &filePath, BitrateHistoryFormat format = BitrateHistoryFormat::CSV) const;
+
+    /*!
+        \details Returns the number of events received from the underlying JavaScript player so far, keyed by event name.
+    */
+    std::map<CYIString, uint64_t> GetEventCounts() const;
+
+    /*!
+        \details Emitted when a seek is sent to the underlying JavaScript player. Only one seek is in flight at a time,
+        seek requests made while a seek is in flight replace any previously queued request.
+    */
+    CYISignal<const SeekTiming &> SeekStarted;
+
+    /*!
+        \details Emitted when the underlying JavaScript player has completed the seek which was in flight.
+    */
+    CYISignal<const SeekTiming &> SeekCompleted;
+
 private:
     CYIBitmovinVideoPlayer() = default;
     virtual void Init_() override;
@@ -1,11 +1,27 @@
 #ifndef _YI_BITMOVIN_VIDEO_PLAYER_PRIV_H_
 #define _YI_BITMOVIN_VIDEO_PLAYER_PRIV_H_
 
+#include "YiBitmovinBitrateHistory.h"
+#include "YiBitmovinBridgeRecorder.h"
+#include "YiBitmovinBridgeScheduler.h"
+#include "YiBitmovinBridgeTransport.h"
+#include "YiBitmovinCommandPipeline.h"
+#include "YiBitmovinEventDispatcher.h"
+#include "YiBitmovinLatencyRecorder.h"
+#include "YiBitmovinPlayheadClock.h"
+#include "YiBitmovinQoEMetrics.h"
+#include "YiBitmovinStatisticsSnapshot.h"
 #include "YiBitmovinVideoPlayer.h"
 #include "YiBitmovinVideoSurface.h"
 
 #include <platform/YiWebMessagingBridge.h>
+#include <thread/YiFuture.h>
 #include <utility/YiRapidJSONUtility.h>
+#include <utility/YiTimer.h>
+
+#include <functional>
+#include <map>
+#include <memory>
 
 class CYIBitmovinVideoPlayer;
 
@@ -18,22 +34,27 @@ public:
     virtual ~CYIBitmovinVideoPlayerPriv();
 
     void SetVideoRectangle(const YI_RECT_REL &videoRectangle);
+    void SetVideoRectangleKeyframeInterval(std::chrono::milliseconds keyframeInterval);
+    void SetVideoTimeUpdateInterval(std::chrono::milliseconds interval);
+    std::chrono::milliseconds GetVideoTimeUpdateInterval() const;
     void Init();
     CYIString GetName() const;
     CYIString GetNickname() const;
     CYIString GetVersion() const;
     CYIAbstractVideoPlayer::Statistics GetStatistics() const;
+    uint64_t GetStatisticsGeneration() const;
     void SetNickname(const CYIString &nickname) const;
     std::unique_ptr<CYIVideoSurface> CreateSurface();
     bool SupportsFormat(CYIAbstractVideoPlayer::StreamingFormat format, CYIAbstractVideoPlayer::DRMScheme drmScheme = CYIAbstractVideoPlayer::DRMScheme::None) const;
     void Prepare(const CYIUrl &videoURI, CYIAbstractVideoPlayer::StreamingFormat format);
+    void PreloadSource(const CYIUrl &videoURI, CYIAbstractVideoPlayer::StreamingFormat format, CYIAbstractVideoPlayer::DRMConfiguration *pDRMConfiguration);
     void Play();
     void Pause();
     void Stop();
     uint64_t GetDurationMs() const;
     uint64_t GetCurrentTimeMs() const;
     void Seek(uint64_t seekPositionMS);
-    bool SelectAudioTrack(uint32_t id);
+    bool SelectAudioTrack(uint32_t id, CYIFuture<bool> selectedFuture = CYIFuture<bool>());
     std::vector<CYIAbstractVideoPlayer::AudioTrackInfo> GetAudioTracks() const;
     CYIAbstractVideoPlayer::AudioTrackInfo GetActiveAudioTrack() const;
     bool IsMuted() const;
@@ -41,15 +62,35 @@ public:
     bool IsTextTrackEnabled() const;
     void EnableTextTrack();
     void DisableTextTrack();
-    bool SelectTextTrack(uint32_t textID, bool enableTextTrack = true);
+    bool SelectTextTrack(uint32_t textID, bool enableTextTrack = true, CYIFuture<bool> selectedFuture = CYIFuture<bool>());
     std::vector<CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo> GetTextTracks() const;
     CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo GetActiveTextTrack() const;
     void AddExternalTextTrack(const CYIString &url, const CYIString &language, const CYIString &label, const CYIString &type, const CYIString &format, bool enable);
     CYIAbstractVideoPlayer::TimedMetadataInterface *GetTimedMetadataInterface() const;
+    std::map<CYIString, uint64_t> GetEventCounts() const;
+    CYIBitmovinVideoPlayer::QoESummary GetQoESummary() const;
+    void SetBitrateHistoryMemoryBudget(size_t memoryBudgetBytes);
+    std::vector<CYIBitmovinVideoPlayer::BitrateSample> GetBitrateHistory(uint64_t startTimeMs, uint64_t endTimeMs) const;
+    std::vector<CYIBitmovinVideoPlayer::BitrateSample> GetDownsampledBitrateHistory(size_t maximumSampleCount, uint64_t startTimeMs, uint64_t endTimeMs) const;
+    bool ExportBitrateHistory(const CYIString &filePath, CYIBitmovinVideoPlayer::BitrateHistoryFormat format) const;
+
+    static void SetCapabilityCacheFilePath(const CYIString &filePath);
+    static std::vector<CYIBitmovinVideoPlayer::BridgeLatencyStatistics> GetBridgeLatencyStatistics();
+    static bool DumpBridgeLatencyStatistics(const CYIString &filePath);
+    static void SetBridgeTimeoutPolicy(const CYIBitmovinLatencyRecorder::TimeoutPolicy &timeoutPolicy);
+    static bool StartBridgeRecording(const CYIString &filePath, uint64_t maximumCaptureSizeBytes);
+    static void StopBridgeRecording();
+    static CYIFuture<bool> Prewarm(yi::rapidjson::Document &&playerConfiguration);
+    static void ReleasePrewarm();
 
 protected:
-    CYIWebMessagingBridge::FutureResponse CallStaticPlayerFunction(yi::rapidjson::Document &&commandDocument, const CYIString &functionName, yi::rapidjson::Value &&playerFunctionArgumentsValue = yi::rapidjson::Value(yi::rapidjson::kArrayType), bool *pMessageSent = nullptr) const;
-    CYIWebMessagingBridge::FutureResponse CallPlayerInstanceFunction(yi::rapidjson::Document &&commandDocument, const CYIString &functionName, yi::rapidjson::Value &&playerFunctionArgumentsValue = yi::rapidjson::Value(yi::rapidjson::kArrayType), bool *pMessageSent = nullptr) const;
+    bool CallPlayerFunction(CYIBitmovinBridgeTransport::Target target, const char *pFunctionName, yi::rapidjson::Document &&commandDocument, yi::rapidjson::Value &&playerFunctionArgumentsValue) const;
+    bool CallPlayerFunctionAndWait(CYIBitmovinBridgeTransport::Target target, const char *pFunctionName, yi::rapidjson::Document &&commandDocument, yi::rapidjson::Value &&playerFunctionArgumentsValue, const std::function<void(const yi::rapidjson::Value &result)> &resultHandler) const;
+    bool SendStaticPlayerCommand(const char *pFunctionName, yi::rapidjson::Document &&commandDocument, yi::rapidjson::Value &&playerFunctionArgumentsValue, CYIBitmovinCommandPipeline::CompletionCallback &&completionCallback = CYIBitmovinCommandPipeline::CompletionCallback(), uint64_t timeoutMs = CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS);
+    bool SendPlayerInstanceCommand(const char *pFunctionName);
+    bool SendPlayerInstanceCommand(const char *pFunctionName, yi::rapidjson::Document &&commandDocument, yi::rapidjson::Value &&playerFunctionArgumentsValue, CYIBitmovinCommandPipeline::CompletionCallback &&completionCallback = CYIBitmovinCommandPipeline::CompletionCallback(), uint64_t timeoutMs = CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS);
+    bool SendPlayerCommand(CYIBitmovinCommandPipeline::Target target, const char *pFunctionName, yi::rapidjson::Document &&commandDocument, yi::rapidjson::Value &&playerFunctionArgumentsValue, CYIBitmovinCommandPipeline::CompletionCallback &&completionCallback, uint64_t timeoutMs);
+    void NotifyCommandFailed(const CYIString &functionName, const CYIBitmovinCommandPipeline::Result &result);
     void CreatePlayerInstance();
     void InitializePlayerInstance();
     void DestroyPlayerInstance();
@@ -69,8 +110,7 @@ private:
         Complete
     };
 
-    uint64_t RegisterEventHandler(const CYIString &eventName, CYIWebMessagingBridge::EventCallback &&eventCallback);
-    void UnregisterEventHandler(uint64_t &eventHandlerId);
+    void AddEventHandlers();
     void RegisterEventHandlers();
     void UnregisterEventHandlers();
     void OnBitrateChanged(const yi::rapidjson::Value &eventValue);
@@ -80,19 +120,92 @@ private:
     void OnAudioTracksChanged(const yi::rapidjson::Value &eventValue);
     void OnVideoDurationChanged(const yi::rapidjson::Value &eventValue);
     void OnVideoTimeChanged(const yi::rapidjson::Value &eventValue);
+    void UpdateVideoTime(double currentTimeSeconds, float bufferLengthMs);
     void OnStateChanged(const yi::rapidjson::Value &eventValue);
     void OnTextTracksChanged(const yi::rapidjson::Value &eventValue);
     void OnMetadataAvailable(const yi::rapidjson::Value &eventValue);
+    void OnSeekCompleted(const yi::rapidjson::Value &eventValue);
+    void OnActiveAudioTrackChanged(const yi::rapidjson::Value &eventValue);
+    void OnActiveTextTrackChanged(const yi::rapidjson::Value &eventValue);
+    void OnTextTrackStatusChanged(const yi::rapidjson::Value &eventValue);
+    void OnMuteStatusChanged(const yi::rapidjson::Value &eventValue);
+    void OnStateSnapshot(const yi::rapidjson::Value &eventValue);
+    void UpdateActiveAudioTrack(const yi::rapidjson::Value &trackValue);
+    void UpdateActiveTextTrack(const yi::rapidjson::Value &trackValue);
+    void StartSeek(uint64_t seekPositionMs);
+    void CompleteSeek();
+    void ResetSeekState();
+    void UpdatePlayheadClock();
+    void PublishStatistics();
+    void OnSeekTimeoutTimerTimedOut();
+    void SendVideoRectangle(const YI_RECT_REL &videoRectangle);
+    void OnVideoRectangleKeyframeTimerTimedOut();
+
+    struct CapabilityMatrix
+    {
+        CYIString playerVersion;
+        std::map<std::pair<CYIAbstractVideoPlayer::StreamingFormat, CYIAbstractVideoPlayer::DRMScheme>, bool> supported;
+    };
+
+    void ProbeCapabilities();
+    bool ProbeCapabilitiesNow() const;
 
     static CYIString PlayerStateToString(PlayerState state);
+    static yi::rapidjson::Value CreateCapabilityQueriesValue(yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator);
+    static bool ParseCapabilityProbeResult(const yi::rapidjson::Value &resultValue, CapabilityMatrix &capabilityMatrix);
+    static void UpdateCapabilityMatrix(CapabilityMatrix &&capabilityMatrix);
+    static bool LoadCapabilityMatrix(CapabilityMatrix &capabilityMatrix, const CYIString &playerVersion); // note: an empty player version accepts a cache written by any version
+    static void SaveCapabilityMatrix(const CapabilityMatrix &capabilityMatrix);
+
+    static CapabilityMatrix s_capabilityMatrix;
+    static bool s_capabilityMatrixRevalidated;
+    static bool s_capabilityLookupFailed;
+    static CYIString s_playerVersion; // note: empty until the player has reported its version
+    static const CYIBitmovinVideoPlayerPriv *s_pCapabilityProbeOwner; // note: the capability matrix is shared, so only one player probes it at a time
+    static CYIString s_capabilityCacheFilePath;
+    static CYIBitmovinLatencyRecorder s_latencyRecorder;
+    static std::unique_ptr<CYIBitmovinBridgeRecorder> s_pBridgeRecorder;
+
+    // note: the pre-warm is not tied to a player, so it has a command pipeline of its own. The pipeline is kept while a pre-warm is in
+    // flight and released once no response is outstanding, since it owns timers which must not outlive the engine.
+    struct PlayerPrewarm
+    {
+        enum class State
+        {
+            Idle, // note: nothing is warm for the next player, either because the pre-warm failed or because a player attached to it
+            Pending,
+            Ready
+        };
+
+        PlayerPrewarm();
+
+        // note: owned through a pointer so that it can outlive the pre-warm when the pre-warm is released from one of the pipeline's callbacks
+        std::unique_ptr<CYIBitmovinCommandPipeline> pCommandPipeline;
+        CYIFuture<bool> readyFuture;
+        State state;
+        uint64_t generation; // note: advanced when the warm player is consumed, so that an outstanding response does not mark it ready again
+    };
+
+    static void ConsumePlayerPrewarm();
+    static void ReleaseIdlePlayerPrewarm();
+
+    static std::unique_ptr<PlayerPrewarm> s_pPlayerPrewarm;
+    static uint64_t s_nextInstanceId;
 
-    bool m_messageHandlersRegistered;
     YI_RECT_REL m_previousVideoRectangle;
+    std::chrono::milliseconds m_videoRectangleKeyframeInterval;
+    std::chrono::steady_clock::time_point m_lastVideoRectangleKeyframeTime;
+    bool m_videoRectangleKeyframePending;
+    CYITimer m_videoRectangleKeyframeTimer;
+    std::chrono::milliseconds m_videoTimeUpdateInterval;
+    bool m_playerInstanceCreated;
     CYIAbstractVideoPlayer::PlaybackState m_stateBeforeBuffering;
     uint64_t m_currentTimeMs;
     uint64_t m_durationMs;
     bool m_buffering;
     bool m_isLive;
+    bool m_playing;
+    CYIBitmovinPlayheadClock m_playheadClock;
     float m_initialAudioBitrateKbps;
     float m_currentAudioBitrateKbps;
     float m_initialVideoBitrateKbps;
@@ -100,18 +213,30 @@ private:
     float m_initialTotalBitrateKbps;
     float m_currentTotalBitrateKbps;
     float m_bufferLengthMs;
+    CYIBitmovinStatisticsSnapshot m_statisticsSnapshot;
+    CYIBitmovinQoEMetrics m_qoeMetrics;
+    CYIBitmovinBitrateHistory m_bitrateHistory;
+    bool m_seekInFlight;
+    bool m_seekQueued;
+    uint64_t m_queuedSeekPositionMs;
+    uint32_t m_coalescedSeekCount;
+    CYIBitmovinVideoPlayer::SeekTiming m_currentSeekTiming;
+    CYITimer m_seekTimeoutTimer;
+    uint64_t m_stateSnapshotVersion;
+    bool m_muted;
+    bool m_textTrackEnabled;
+    CYIAbstractVideoPlayer::AudioTrackInfo m_activeAudioTrack;
+    CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo m_activeTextTrack;
+    mutable CYIString m_nickname;
+
+    // note: identifies this player's instance in the JS player registry, commands reach it through its own instance accessor and its events are routed by ID
+    uint64_t m_instanceId;
+    CYIString m_instanceAccessorName;
+
     yi::rapidjson::Document m_playerConfiguration;
+    mutable CYIBitmovinCommandPipeline m_commandPipeline;
 
-    uint64_t m_bitrateChangedEventHandlerId;
-    uint64_t m_bufferingStateChangedEventHandlerId;
-    uint64_t m_liveStatusEventHandlerId;
-    uint64_t m_playerErrorEventHandlerId;
-    uint64_t m_audioTracksChangedEventHandlerId;
-    uint64_t m_videoDurationChangedEventHandlerId;
-    uint64_t m_videoTimeChangedEventHandlerId;
-    uint64_t m_stateChangedEventHandlerId;
-    uint64_t m_textTracksChangedEventHandlerId;
-    uint64_t m_metadataAvailableEventHandlerId;
+    CYIBitmovinEventDispatcher m_eventDispatcher;
 
     std::vector<CYIAbstractVideoPlayer::AudioTrackInfo> m_audioTracks;
     std::vector<CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo> m_textTracks;
@@ -1,11 +1,22 @@
 #include "YiTizenNaClRemoteLoggerSink.h"
 
+#include "YiBitmovinBridgeScheduler.h"
+
 #include <platform/YiWebBridgeLocator.h>
 #include <utility/YiRapidJSONUtility.h>
 
+#include <algorithm>
+#include <functional>
+#include <string>
+
 #define LOG_TAG "CYITizenNaClRemoteLoggerSink"
 
 static const char *REMOTE_LOGGER_CLASS_NAME = "CYIRemoteLogger";
+static const char *REMOTE_LOG_BATCH_FUNCTION_NAME = "remoteLogBatch";
+static const char *SUPPRESSED_MESSAGES_LEVEL = "warning";
+static const float DEFAULT_RATE_LIMIT_MESSAGES_PER_SECOND = 20.0f;
+static const uint32_t DEFAULT_RATE_LIMIT_BURST = 50;
+static const std::chrono::seconds TOKEN_BUCKET_SWEEP_INTERVAL(1);
 
 static CYIWebMessagingBridge::FutureResponse CallTizenRemoteLoggerFunction(yi::rapidjson::Document &&message, const CYIString &functionName, yi::rapidjson::Value &&functionArgumentsValue = yi::rapidjson::Value(yi::rapidjson::kArrayType))
 {
@@ -34,11 +45,23 @@ static void UnregisterTizenRemoteLoggerEventHandler(uint64_t &eventHandlerId)
 CYITizenNaClRemoteLoggerSink::CYITizenNaClRemoteLoggerSink()
 	: m_remoteLoggerInitialized(false)
 	, m_remoteLoggerInitializedEventHandlerId(0)
+	, m_messagesPerSecond(DEFAULT_RATE_LIMIT_MESSAGES_PER_SECOND)
+	, m_burst(DEFAULT_RATE_LIMIT_BURST)
+	, m_suppressedMessageCount(0)
 {
 	set_pattern("%^%Y-%m-%d %T.%e %P:%t [%n] %L/%s:%#:%!:   %v%$");
 
+	// log messages share the web messaging bridge with the video player, so they are queued on the scheduler's logging lane and sent in bulk
+	// rather than one bridge message per line, the scheduler is created here since it must be created on the main thread
+	CYIBitmovinBridgeScheduler &scheduler = CYIBitmovinBridgeScheduler::GetInstance();
+
+	// messages logged before the JS remote logger is ready are spooled by the scheduler and replayed in bulk once it reports that it is
+	scheduler.SetLogMessagesHeld(true);
+
 	m_remoteLoggerInitializedEventHandlerId = RegisterTizenRemoteLoggerEventHandler("initialized", [this](yi::rapidjson::Document &&) {
-		m_remoteLoggerInitialized.store(true);
+		if(!m_remoteLoggerInitialized.exchange(true)) {
+			CYIBitmovinBridgeScheduler::GetInstance().SetLogMessagesHeld(false);
+		}
 	});
 
 	yi::rapidjson::Document messageDocument(yi::rapidjson::kObjectType);
@@ -48,38 +71,158 @@ CYITizenNaClRemoteLoggerSink::CYITizenNaClRemoteLoggerSink()
 
 CYITizenNaClRemoteLoggerSink::~CYITizenNaClRemoteLoggerSink() {
 	UnregisterTizenRemoteLoggerEventHandler(m_remoteLoggerInitializedEventHandlerId);
+
+	// spooled messages would otherwise never be sent
+	if(!m_remoteLoggerInitialized.load()) {
+		CYIBitmovinBridgeScheduler::GetInstance().SetLogMessagesHeld(false);
+	}
+}
+
+void CYITizenNaClRemoteLoggerSink::SetRateLimit(float messagesPerSecond, uint32_t burst) {
+	m_messagesPerSecond.store(std::max(messagesPerSecond, 0.0f));
+	m_burst.store(std::max<uint32_t>(burst, 1));
+}
+
+uint64_t CYITizenNaClRemoteLoggerSink::GetSuppressedMessageCount() const {
+	return m_suppressedMessageCount.load();
 }
 
 void CYITizenNaClRemoteLoggerSink::sink_it_(const CYILogMessage &message)
 {
-	static const CYIString REMOTE_LOG_FUNCTION_NAME("remoteLog");
+	// the level and call site come from the log message itself, so messages over their rate limit are dropped without being formatted
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	uint64_t suppressedMessageCount = 0;
+
+	bool withinRateLimit = ConsumeToken(message, now, suppressedMessageCount);
+
+	// the sweep reports messages dropped at call sites which have not logged since
+	SweepTokenBuckets(now);
+
+	if(!withinRateLimit) {
+		return;
+	}
+
+	if(suppressedMessageCount > 0) {
+		CallSite callSite;
+		callSite.pFileName = message.source.filename;
+		callSite.line = message.source.line;
+
+		QueueSuppressedMessagesMessage(callSite, suppressedMessageCount);
+	}
+
+	CYIBitmovinBridgeScheduler &scheduler = CYIBitmovinBridgeScheduler::GetInstance();
 
 	CYIString formattedMessage = CYILogSink::FormatMessage(message);
 	formattedMessage.TrimRight(); // remove a redundant newline at the end since our JS logger will supply one anyway
 
-	yi::rapidjson::Document messageDocument(yi::rapidjson::kObjectType);
-	yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &messageAllocator = messageDocument.GetAllocator();
+	// the message is copied into a preallocated slot of the scheduler's log queue without taking a lock, a full queue drops the message
+	// and counts it rather than stalling the thread which logged it
+	scheduler.QueueLogMessage(REMOTE_LOGGER_CLASS_NAME, REMOTE_LOG_BATCH_FUNCTION_NAME, GetLevelName(message), formattedMessage.GetData(), formattedMessage.GetSizeInBytes());
+}
+
+bool CYITizenNaClRemoteLoggerSink::CallSite::operator==(const CallSite &other) const {
+	return pFileName == other.pFileName && line == other.line;
+}
+
+size_t CYITizenNaClRemoteLoggerSink::CallSiteHash::operator()(const CallSite &callSite) const {
+	// file names are string literals, so call sites in the same file share the same pointer and it can be hashed rather than the string
+	return std::hash<const char *>()(callSite.pFileName) ^ (std::hash<int>()(callSite.line) * 31);
+}
+
+bool CYITizenNaClRemoteLoggerSink::ConsumeToken(const CYILogMessage &message, std::chrono::steady_clock::time_point now, uint64_t &suppressedMessageCount) {
+	float messagesPerSecond = m_messagesPerSecond.load();
 
-	CYIString level("debug");
+	if(messagesPerSecond <= 0.0f || message.level >= spdlog::level::critical) {
+		return true;
+	}
+
+	float burst = static_cast<float>(m_burst.load());
+
+	CallSite callSite;
+	callSite.pFileName = message.source.filename;
+	callSite.line = message.source.line;
+
+	std::unordered_map<CallSite, TokenBucket, CallSiteHash>::iterator tokenBucketIterator = m_tokenBuckets.find(callSite);
 
-	if(formattedMessage.IndexOf("[Yi] I/") != CYIString::NPos) {
-		level = "info";
+	if(tokenBucketIterator == m_tokenBuckets.end()) {
+		TokenBucket tokenBucket;
+		tokenBucket.tokens = burst;
+		tokenBucket.lastRefillTime = now;
+		tokenBucket.suppressedMessageCount = 0;
+
+		tokenBucketIterator = m_tokenBuckets.emplace(callSite, tokenBucket).first;
 	}
-	else if(formattedMessage.IndexOf("[Yi] W/") != CYIString::NPos) {
-		level = "warning";
+
+	TokenBucket &tokenBucket = tokenBucketIterator->second;
+
+	float elapsedSeconds = std::chrono::duration<float>(now - tokenBucket.lastRefillTime).count();
+	tokenBucket.tokens = std::min(tokenBucket.tokens + elapsedSeconds * messagesPerSecond, burst);
+	tokenBucket.lastRefillTime = now;
+
+	if(tokenBucket.tokens < 1.0f) {
+		tokenBucket.suppressedMessageCount++;
+		m_suppressedMessageCount.fetch_add(1);
+
+		return false;
 	}
-	else if(formattedMessage.IndexOf("[Yi] E/") != CYIString::NPos || formattedMessage.IndexOf("[Yi] F/") != CYIString::NPos) {
-		level = "error";
+
+	tokenBucket.tokens -= 1.0f;
+
+	suppressedMessageCount = tokenBucket.suppressedMessageCount;
+	tokenBucket.suppressedMessageCount = 0;
+
+	return true;
+}
+
+void CYITizenNaClRemoteLoggerSink::SweepTokenBuckets(std::chrono::steady_clock::time_point now) {
+	if(now < m_nextTokenBucketSweepTime) {
+		return;
+	}
+
+	m_nextTokenBucketSweepTime = now + TOKEN_BUCKET_SWEEP_INTERVAL;
+
+	float messagesPerSecond = m_messagesPerSecond.load();
+	float burst = static_cast<float>(m_burst.load());
+
+	std::unordered_map<CallSite, TokenBucket, CallSiteHash>::iterator tokenBucketIterator = m_tokenBuckets.begin();
+
+	while(tokenBucketIterator != m_tokenBuckets.end()) {
+		TokenBucket &tokenBucket = tokenBucketIterator->second;
+
+		float elapsedSeconds = std::chrono::duration<float>(now - tokenBucket.lastRefillTime).count();
+		tokenBucket.tokens = std::min(tokenBucket.tokens + elapsedSeconds * std::max(messagesPerSecond, 0.0f), burst);
+		tokenBucket.lastRefillTime = now;
+
+		if(tokenBucket.suppressedMessageCount > 0) {
+			QueueSuppressedMessagesMessage(tokenBucketIterator->first, tokenBucket.suppressedMessageCount);
+			tokenBucket.suppressedMessageCount = 0;
+		}
+
+		// a full bucket behaves exactly like a new one, and buckets are no longer used once rate limiting is disabled
+		if(tokenBucket.tokens >= burst || messagesPerSecond <= 0.0f) {
+			tokenBucketIterator = m_tokenBuckets.erase(tokenBucketIterator);
+		} else {
+			++tokenBucketIterator;
+		}
 	}
+}
 
-	yi::rapidjson::Value argsArray(yi::rapidjson::kArrayType);
-	yi::rapidjson::Value logLevel(level.GetData(), messageAllocator);
-	argsArray.PushBack(logLevel, messageAllocator);
+void CYITizenNaClRemoteLoggerSink::QueueSuppressedMessagesMessage(const CallSite &callSite, uint64_t suppressedMessageCount) {
+	std::string suppressedMessagesMessage = "Suppressed " + std::to_string(suppressedMessageCount) + " log messages from " + (callSite.pFileName ? callSite.pFileName : "unknown") + ":" + std::to_string(callSite.line) + ".";
 
-	yi::rapidjson::Value messageArray(yi::rapidjson::kArrayType);
-	yi::rapidjson::Value messageValue(formattedMessage.GetData(), messageAllocator);
-	messageArray.PushBack(messageValue, messageAllocator);
-	argsArray.PushBack(messageArray, messageAllocator);
+	CYIBitmovinBridgeScheduler::GetInstance().QueueLogMessage(REMOTE_LOGGER_CLASS_NAME, REMOTE_LOG_BATCH_FUNCTION_NAME, SUPPRESSED_MESSAGES_LEVEL, suppressedMessagesMessage.data(), suppressedMessagesMessage.size());
+}
 
-	CallTizenRemoteLoggerFunction(std::move(messageDocument), REMOTE_LOG_FUNCTION_NAME, std::move(argsArray));
+const char *CYITizenNaClRemoteLoggerSink::GetLevelName(const CYILogMessage &message) {
+	switch(message.level) {
+		case spdlog::level::info:
+			return "info";
+		case spdlog::level::warn:
+			return "warning";
+		case spdlog::level::err:
+		case spdlog::level::critical:
+			return "error";
+		default:
+			return "debug";
+	}
 }
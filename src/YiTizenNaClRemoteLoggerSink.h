@@ -3,18 +3,63 @@
 
 #include <logging/YiLogSink.h>
 
+#include <atomic>
+#include <chrono>
+#include <unordered_map>
+
+// note: each logging call site is rate limited by a token bucket of its own, so that a single call site logging in a tight loop cannot
+// flood the remote logger. Messages over the limit are dropped before they are formatted, and the number dropped is reported once the
+// call site logs within its limit again, or by the next sweep of the token buckets. Fatal messages are never rate limited.
+// note: the token buckets are swept at most once a second, when any call site logs. A sweep reports the messages dropped at every call
+// site and evicts the buckets which have refilled and have nothing to report, so call sites which stopped logging do not accumulate.
 class CYITizenNaClRemoteLoggerSink : public CYILogSink
 {
 public:
 	CYITizenNaClRemoteLoggerSink();
 	virtual ~CYITizenNaClRemoteLoggerSink();
 
+	// note: a rate of zero disables rate limiting
+	void SetRateLimit(float messagesPerSecond, uint32_t burst);
+	uint64_t GetSuppressedMessageCount() const;
+
 protected:
 	virtual void sink_it_(const CYILogMessage &message) override;
 
 private:
+	struct CallSite
+	{
+		const char *pFileName;
+		int line;
+
+		bool operator==(const CallSite &other) const;
+	};
+
+	struct CallSiteHash
+	{
+		size_t operator()(const CallSite &callSite) const;
+	};
+
+	struct TokenBucket
+	{
+		float tokens;
+		std::chrono::steady_clock::time_point lastRefillTime;
+		uint64_t suppressedMessageCount;
+	};
+
+	bool ConsumeToken(const CYILogMessage &message, std::chrono::steady_clock::time_point now, uint64_t &suppressedMessageCount);
+	void SweepTokenBuckets(std::chrono::steady_clock::time_point now);
+	static void QueueSuppressedMessagesMessage(const CallSite &callSite, uint64_t suppressedMessageCount);
+	static const char *GetLevelName(const CYILogMessage &message);
+
 	std::atomic_bool m_remoteLoggerInitialized;
 	uint64_t m_remoteLoggerInitializedEventHandlerId;
+	std::atomic<float> m_messagesPerSecond;
+	std::atomic<uint32_t> m_burst;
+	std::atomic<uint64_t> m_suppressedMessageCount;
+
+	// note: only accessed from sink_it_, which the base sink serializes
+	std::unordered_map<CallSite, TokenBucket, CallSiteHash> m_tokenBuckets;
+	std::chrono::steady_clock::time_point m_nextTokenBucketSweepTime;
 };
 
 #endif // _YI_TIZEN_NACL_REMOTE_LOGGER_SINK_H_